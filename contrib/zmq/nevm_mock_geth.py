@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+# Copyright (c) 2024 The Syscoin Core developers
+# Distributed under the MIT software license, see the accompanying
+# file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+"""
+    Minimal stand-in for sysgeth's NEVM endpoint, used to benchmark
+    synchronous versus pipelined NEVM block connects without a real geth.
+
+    Start the mock first, then point syscoind at it:
+        contrib/zmq/nevm_mock_geth.py --bind tcp://127.0.0.1:1111 --latency-ms 5
+        syscoind -reindex -zmqpubnevm=tcp://127.0.0.1:1111 -nevmconnectwindow=64
+
+    Every reply is delayed by --latency-ms to model the geth round trip.
+    The socket is a ROUTER, so pipelined connects keep arriving while their
+    replies are held back: each one is answered --latency-ms after it came
+    in, newest first whenever several are due, so acks also arrive out of
+    order. With -nevmconnectwindow=1 each block waits for that delay, with a
+    larger window the delays overlap and only the processing time remains.
+    --fail-height makes the mock refuse the connect at that height (counted
+    from the first connect it sees) to exercise the rollback path.
+"""
+
+import argparse
+import struct
+import sys
+import time
+
+import zmq
+
+NEVM_HEADER_SIZE = 32 * 3
+
+
+def read_compact_size(buf, pos):
+    n = buf[pos]
+    pos += 1
+    if n == 253:
+        n = struct.unpack_from("<H", buf, pos)[0]
+        pos += 2
+    elif n == 254:
+        n = struct.unpack_from("<I", buf, pos)[0]
+        pos += 4
+    elif n == 255:
+        n = struct.unpack_from("<Q", buf, pos)[0]
+        pos += 8
+    return n, pos
+
+
+def sys_block_hash(payload):
+    """Return the Syscoin block hash of a nevmconnect payload in GetHex() order."""
+    pos = NEVM_HEADER_SIZE
+    size, pos = read_compact_size(payload, pos)
+    pos += size
+    return payload[pos:pos + 32][::-1].hex()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--bind", default="tcp://127.0.0.1:1111", help="endpoint syscoind connects to")
+    parser.add_argument("--latency-ms", type=float, default=0, help="delay added before every reply")
+    parser.add_argument("--fail-height", type=int, default=0, help="refuse the n-th connect (0 = never)")
+    parser.add_argument("--report-every", type=int, default=1000, help="print throughput every n connects")
+    args = parser.parse_args()
+
+    ctx = zmq.Context()
+    socket = ctx.socket(zmq.ROUTER)
+    socket.bind(args.bind)
+    latency = args.latency_ms / 1000.0
+    connects = 0
+    failed = False
+    # (due time, envelope, reply) of pipelined connects not answered yet
+    pending = []
+    max_pending = 0
+    start = time.time()
+    print("mock geth listening on {}, latency {}ms".format(args.bind, args.latency_ms))
+    try:
+        while True:
+            due = [p for p in pending if p[0] <= time.time()]
+            if due:
+                pending = [p for p in pending if p[0] > time.time()]
+                for _, envelope, reply in reversed(due):
+                    socket.send_multipart(envelope + reply)
+            timeout = max(0, min(p[0] for p in pending) - time.time()) * 1000 if pending else None
+            if not socket.poll(timeout):
+                continue
+            # ROUTER prefixes the peer identity and the empty delimiter, both address the reply
+            parts = socket.recv_multipart()
+            envelope, parts = parts[:2], parts[2:]
+            topic = parts[0]
+            if topic != b"nevmconnectpipe" and latency:
+                time.sleep(latency)
+            if topic == b"nevmcomms":
+                socket.send_multipart(envelope + [b"nevmcomms", b"ack"])
+            elif topic == b"nevmblockinfo":
+                socket.send_multipart(envelope + [b"nevmblockinfo", str(connects).encode()])
+            elif topic in (b"nevmconnect", b"nevmconnectpipe"):
+                connects += 1
+                if args.fail_height and connects == args.fail_height:
+                    failed = True
+                # once a block was refused everything built on top of it is refused too
+                res = b"not connected" if failed else b"connected"
+                if topic == b"nevmconnect":
+                    socket.send_multipart(envelope + [topic, res])
+                else:
+                    pending.append((time.time() + latency, envelope, [topic, sys_block_hash(parts[1]).encode(), res]))
+                    max_pending = max(max_pending, len(pending))
+                if connects % args.report_every == 0:
+                    elapsed = time.time() - start
+                    print("{} connects, {:.1f} blocks/s, up to {} in flight".format(connects, connects / elapsed, max_pending))
+            elif topic == b"nevmdisconnect":
+                failed = False
+                socket.send_multipart(envelope + [b"nevmdisconnect", b"disconnected"])
+            else:
+                print("unknown topic {}".format(topic), file=sys.stderr)
+                socket.send_multipart(envelope + [topic, b""])
+    except KeyboardInterrupt:
+        pass
+    finally:
+        socket.close()
+        ctx.term()
+
+
+if __name__ == "__main__":
+    main()
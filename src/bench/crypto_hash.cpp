@@ -4,6 +4,7 @@
 
 
 #include <bench/bench.h>
+#include <crypto/multihash.h>
 #include <crypto/muhash.h>
 #include <crypto/ripemd160.h>
 #include <crypto/sha1.h>
@@ -110,6 +111,57 @@ static void NEVM_BLAKE2S_256_1M(benchmark::Bench& bench)
     });
 }
 
+/* A block worth of PoDA blobs: 32 blobs of 128KiB */
+static const size_t BLOB_COUNT = 32;
+static const size_t BLOB_SIZE = 128 * 1024;
+
+static void PoDABlobHash(benchmark::Bench& bench, multihash_implementation::UseImplementation use_implementation, bool keccak)
+{
+    bench.name(strprintf("%s using the '%s' blob hash implementation", bench.name(), MultiHashAutoDetect(use_implementation)));
+    std::vector<std::vector<uint8_t>> blobs(BLOB_COUNT, std::vector<uint8_t>(BLOB_SIZE, 0));
+    std::vector<Span<const unsigned char>> in(blobs.begin(), blobs.end());
+    std::vector<uint8_t> out(32 * in.size());
+    bench.batch(BLOB_COUNT * BLOB_SIZE).unit("byte").run([&] {
+        if (keccak) {
+            Keccak256Multi(out.data(), in.data(), in.size());
+        } else {
+            Blake2s256Multi(out.data(), in.data(), in.size());
+        }
+        ankerl::nanobench::doNotOptimizeAway(out);
+    });
+    MultiHashAutoDetect();
+}
+
+static void NEVM_KECCAK_256_BLOBS_STANDARD(benchmark::Bench& bench)
+{
+    PoDABlobHash(bench.name(__func__), multihash_implementation::STANDARD, /*keccak=*/true);
+}
+
+static void NEVM_KECCAK_256_BLOBS_AVX2(benchmark::Bench& bench)
+{
+    PoDABlobHash(bench.name(__func__), multihash_implementation::USE_AVX2, /*keccak=*/true);
+}
+
+static void NEVM_KECCAK_256_BLOBS_AVX512(benchmark::Bench& bench)
+{
+    PoDABlobHash(bench.name(__func__), multihash_implementation::USE_ALL, /*keccak=*/true);
+}
+
+static void NEVM_BLAKE2S_256_BLOBS_STANDARD(benchmark::Bench& bench)
+{
+    PoDABlobHash(bench.name(__func__), multihash_implementation::STANDARD, /*keccak=*/false);
+}
+
+static void NEVM_BLAKE2S_256_BLOBS_AVX2(benchmark::Bench& bench)
+{
+    PoDABlobHash(bench.name(__func__), multihash_implementation::USE_AVX2, /*keccak=*/false);
+}
+
+static void NEVM_BLAKE2S_256_BLOBS_AVX512(benchmark::Bench& bench)
+{
+    PoDABlobHash(bench.name(__func__), multihash_implementation::USE_ALL, /*keccak=*/false);
+}
+
 static void SHA256_32b_STANDARD(benchmark::Bench& bench)
 {
     bench.name(strprintf("%s using the '%s' SHA256 implementation", __func__, SHA256AutoDetect(sha256_implementation::STANDARD)));
@@ -304,6 +356,12 @@ BENCHMARK(SHA512, benchmark::PriorityLevel::HIGH);
 BENCHMARK(SHA3_256_1M, benchmark::PriorityLevel::HIGH);
 BENCHMARK(NEVM_KECCAK_256_1M, benchmark::PriorityLevel::HIGH);
 BENCHMARK(NEVM_BLAKE2S_256_1M, benchmark::PriorityLevel::HIGH);
+BENCHMARK(NEVM_KECCAK_256_BLOBS_STANDARD, benchmark::PriorityLevel::HIGH);
+BENCHMARK(NEVM_KECCAK_256_BLOBS_AVX2, benchmark::PriorityLevel::HIGH);
+BENCHMARK(NEVM_KECCAK_256_BLOBS_AVX512, benchmark::PriorityLevel::HIGH);
+BENCHMARK(NEVM_BLAKE2S_256_BLOBS_STANDARD, benchmark::PriorityLevel::HIGH);
+BENCHMARK(NEVM_BLAKE2S_256_BLOBS_AVX2, benchmark::PriorityLevel::HIGH);
+BENCHMARK(NEVM_BLAKE2S_256_BLOBS_AVX512, benchmark::PriorityLevel::HIGH);
 
 BENCHMARK(SHA256_32b_STANDARD, benchmark::PriorityLevel::HIGH);
 BENCHMARK(SHA256_32b_SSE4, benchmark::PriorityLevel::HIGH);
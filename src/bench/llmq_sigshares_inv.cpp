@@ -0,0 +1,87 @@
+// Copyright (c) 2024 The Syscoin Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <bench/bench.h>
+
+#include <evo/deterministicmns.h>
+#include <llmq/quorums_signing_shares.h>
+#include <random.h>
+#include <streams.h>
+#include <version.h>
+
+#include <cassert>
+
+namespace {
+// ChainLock quorum size and the most invs a single QSIGSHARESINV message may carry
+constexpr size_t QUORUM_SIZE{400};
+constexpr size_t SESSIONS{200};
+
+// The invs a member of a full quorum sends one peer in a round, covering the shapes seen over the life of a session:
+// a few fresh shares, a contiguous range, a random half and all but a few members
+std::vector<llmq::CSigSharesInv> MakeRound()
+{
+    FastRandomContext rng{/*fDeterministic=*/true};
+    std::vector<llmq::CSigSharesInv> invs(SESSIONS);
+    for (size_t i = 0; i < invs.size(); ++i) {
+        auto& inv = invs[i];
+        inv.sessionId = i;
+        inv.Init(QUORUM_SIZE);
+        switch (i % 4) {
+        case 0:
+            for (int j = 0; j < 4; ++j) {
+                inv.Set(rng.randrange(QUORUM_SIZE), true);
+            }
+            break;
+        case 1: {
+            const size_t start{rng.randrange(QUORUM_SIZE / 2)};
+            for (size_t j = start; j < start + QUORUM_SIZE / 4; ++j) {
+                inv.Set(j, true);
+            }
+            break;
+        }
+        case 2:
+            for (size_t j = 0; j < QUORUM_SIZE; ++j) {
+                inv.Set(j, rng.randbool());
+            }
+            break;
+        default:
+            inv.SetAll(true);
+            for (int j = 0; j < 4; ++j) {
+                inv.Set(rng.randrange(QUORUM_SIZE), false);
+            }
+            break;
+        }
+    }
+    return invs;
+}
+
+void SigSharesInvRoundTrip(benchmark::Bench& bench, int nVersion)
+{
+    const auto invs{MakeRound()};
+    const size_t nLegacySize{GetSerializeSize(invs, LLMQ_COMPACT_INV_VERSION - 1)};
+    const size_t nCompactSize{GetSerializeSize(invs, LLMQ_COMPACT_INV_VERSION)};
+    assert(nCompactSize < nLegacySize);
+
+    CDataStream ss(SER_NETWORK, nVersion);
+    std::vector<llmq::CSigSharesInv> received;
+    bench.batch(invs.size()).unit("inv").run([&] {
+        ss << invs;
+        ss >> received;
+        assert(received.size() == invs.size());
+    });
+}
+} // namespace
+
+static void LLMQSigSharesInvLegacy(benchmark::Bench& bench)
+{
+    SigSharesInvRoundTrip(bench, LLMQ_COMPACT_INV_VERSION - 1);
+}
+
+static void LLMQSigSharesInvCompact(benchmark::Bench& bench)
+{
+    SigSharesInvRoundTrip(bench, LLMQ_COMPACT_INV_VERSION);
+}
+
+BENCHMARK(LLMQSigSharesInvLegacy, benchmark::PriorityLevel::HIGH);
+BENCHMARK(LLMQSigSharesInvCompact, benchmark::PriorityLevel::HIGH);
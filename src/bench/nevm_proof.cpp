@@ -0,0 +1,247 @@
+// Copyright (c) 2024 The Syscoin Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <bench/bench.h>
+
+#include <nevm/nevm.h>
+#include <nevm/sha3.h>
+#include <util/strencodings.h>
+
+#include <cassert>
+
+namespace {
+// Receipt proof of a mainnet bridge transfer, from test/data/nevmspv_valid.json
+const char* const MINT_PROOF_ROOT =
+    "a035b3f3fc04cf2b9f174800736e6b26e12f639483bc3309a56d3c1601861b18f9";
+const char* const MINT_PROOF_PARENT_NODES =
+    "f90685f90131a053da9acfe2e06dc7f04ccbf8beab0413916ebd03ab930f5853ec0f70d2784d52a06a57220d3807f6f06628"
+    "f245094ec54c2fad458cef3721a12c2763ce1775cf9ea0b078eef2f5b7464b3d8369d0d991f14798cf7d50352cd76351e69a"
+    "89a6ed0b9aa070d91b8980bfcc5a82ab3c1e617d60bed2d09d2218080f946ff9c365edeec89da09b4e501c1d4c7e0e279a68"
+    "22257e931c605de663026255220574082913413bbda076680dd1930586a8f0b022a140978cbda42dcbff4875aac67cdf3120"
+    "88fd8905a0f3d9cde79be81863469b08f571e6804bf3449ec4177eb85db4f17d7219f8b7d3a09dd568a81dbb9f09346556fd"
+    "5b406340b1966b1476d0a98b7a22b8812549eec9a0ef2774dd310ee9c9c19302fb1b22661dd56c899f27b7fef6e0817e1e7b"
+    "52ccbe8080808080808080f871a0852be02f7cc9952bfc405dab523dd0742fd9f27ed52719c4ea5cb31c8492f17ba034cf98"
+    "d1e22413868e9ef64adbb676748d404aa7986ecf88f86294ba3c49bbc3a077b9fe32a171d929ee50a8adaee447351ca014f0"
+    "091d64450cb90a346b2339cb8080808080808080808080808080e4820001a0781517f2fc80018ab1d53254cb8a2c92896b75"
+    "cbe8675ccfc6e8c27904a1eed5f851a0ac5e057e83640dc69b28f15749f5553d9fc9bb0fe33d3d4433b82f389871ba57a0d2"
+    "3e202badc0bd8eb182485d80b2c2963ed057c87dd5c60f034c8f9f6223a158808080808080808080808080808080f90211a0"
+    "5063444e0892877cf203e289792a174bc23cfe94adc11a3b3cd2586655fa4d82a00faf3ce245eb01a532cccd06fd831fa86d"
+    "c95110156bbc7e8b8a70b73348ab7ba02ccdb134175fc7d70899fc6ff6f5f397403f3cd559146ee66e18b1af284cb4f8a04b"
+    "63d3f634f4ecbac6c9e6e6f0e2b3bc95bad2893156522833d86ceb7b50cfe8a06c8796c5be4e79afed8ed127a3bf8f6c6caf"
+    "6c212dc07f0980fa4cc274c61c97a089097b0f6083437c2e82d6ef0e491a12a4e8edfdf361ca8dbf72377085a1cad5a021f6"
+    "a41413f17939ea60017321212316b59d8f9692e282bf9fb3374e63ad58bda0c1b7f99db10f3fa341a802f32898b23f8eb38b"
+    "10d5014b74b9e1f2c668a7062fa07391277a5ebeb17828fe72c559194e6e662deabc1ca9e51c451ab280e2354d3ea01aa57b"
+    "364f210122efe5f42fd6abe03f4e5ff676700f2162f152b16eb4fa535fa04521a62ee3201572f3fbf9f21a04f0824725abcb"
+    "ecefab959038cdc67539669da0656bedc18adfa250df4c35f394075af6d2aa99382a312baf035782a78397aceba0c2cbff63"
+    "71719f70e0fdfeafa3a788f0d3de7a74eb3903cb27aea8258cff7d5aa0fa76663d79428e4ac454ecc82be91847b4fa027937"
+    "f6f9d6e1381241e75f44efa05e8a32bf0338915fe83e8aec041413b827c4c9ce78c39417862e5b9cce399771a0a30d1fbc7e"
+    "5c7cd5567991c12846e0d527da0932dc37b992673b5f88a37e66b780f9024f20b9024bf90248018401c3889cb90100000000"
+    "0000000000000000000000200000000000000000000000000400010000000000000000000000000000000000000000000000"
+    "0200000000008000200000000000000000000000000009004000000000000000000000000000000000000000000000020000"
+    "0000000000000008004000000000000000000800180000000000000000000000000000020000000000000000000000000000"
+    "0000000000000002000000000000000000000000000000000000000000000000000000000000000000004200000000000000"
+    "0000000000000000000000000000000000000020000010000000000000000000000000000000000000000000000000000000"
+    "000000f9013cf89c94f3c9b7a97eba579f5c234f79108331f5513c9741f884a08c5be1e5ebec7d5bd14f71427d1e84f3dd03"
+    "14c0f7b2291e5b200ac8c7c3b925a0000000000000000000000000ff190a4cc92b154635140335791d3779f60dc311a00000"
+    "000000000000000000000000000000000000000000000000000000000000a000000000000000000000000000000000000000"
+    "0000000000000000000000205c80f89c94f3c9b7a97eba579f5c234f79108331f5513c9741f884a0ddf252ad1be2c89b69c2"
+    "b068fc378daa952ba7f163c4a11628f55a4df523b3efa0000000000000000000000000ff190a4cc92b154635140335791d37"
+    "79f60dc311a0000000000000000000000000e8bcdac193f0003143434767e0bb1bb1757efa12a00000000000000000000000"
+    "00000000000000000000000000000000000000205c80";
+const char* const MINT_PROOF_VALUE =
+    "f90248018401c3889cb901000000000000000000000000000000200000000000000000000000000400010000000000000000"
+    "0000000000000000000000000000000200000000008000200000000000000000000000000009004000000000000000000000"
+    "0000000000000000000000000200000000000000000008004000000000000000000800180000000000000000000000000000"
+    "0200000000000000000000000000000000000000000002000000000000000000000000000000000000000000000000000000"
+    "0000000000000042000000000000000000000000000000000000000000000000000020000010000000000000000000000000"
+    "000000000000000000000000000000000000f9013cf89c94f3c9b7a97eba579f5c234f79108331f5513c9741f884a08c5be1"
+    "e5ebec7d5bd14f71427d1e84f3dd0314c0f7b2291e5b200ac8c7c3b925a0000000000000000000000000ff190a4cc92b1546"
+    "35140335791d3779f60dc311a00000000000000000000000000000000000000000000000000000000000000000a000000000"
+    "0000000000000000000000000000000000000000000000000000205c80f89c94f3c9b7a97eba579f5c234f79108331f5513c"
+    "9741f884a0ddf252ad1be2c89b69c2b068fc378daa952ba7f163c4a11628f55a4df523b3efa0000000000000000000000000"
+    "ff190a4cc92b154635140335791d3779f60dc311a0000000000000000000000000e8bcdac193f0003143434767e0bb1bb175"
+    "7efa12a0000000000000000000000000000000000000000000000000000000000000205c80";
+const char* const MINT_PROOF_PATH = "82010e";
+
+// The walker VerifyProof replaced, which copies node values and compares hex
+// strings of the path; kept here as the baseline the in-place walker is timed
+// against, nevm_tests keeps the same copy to check both walkers agree.
+static bool LegacyMatchProofValue(dev::bytes node_value,
+                                  const dev::RLP& expected_value,
+                                  std::optional<uint8_t>* envelope_type)
+{
+  if(node_value.empty()) {
+    return false;
+  }
+
+  std::optional<uint8_t> parsed_type;
+  // EIP-2718 values are TransactionType || TransactionPayload, where the
+  // TransactionType range is inclusive: [0x00, 0x7f]. The consensus parser
+  // separately whitelists the authenticated type values it understands.
+  if(node_value[0] <= 0x7f) {
+    parsed_type = node_value[0];
+    node_value.erase(node_value.begin());
+  }
+  if(node_value != expected_value.data().toBytes()) {
+    return false;
+  }
+  if(envelope_type) {
+    *envelope_type = parsed_type;
+  }
+  return true;
+}
+
+static int LegacyNibblesToTraverse(const std::string &encodedPartialPath, const std::string &path, int pathPtr) {
+  if(encodedPartialPath.empty()) {
+    return -1;
+  }
+  std::string partialPath;
+  // typecast as the character
+  uint8_t partialPathInt;
+  char pathPtrInt[2] = {encodedPartialPath[0], '\0'};
+  if(!ParseUInt8(pathPtrInt, &partialPathInt))
+    return -1;
+  if(partialPathInt == 0 || partialPathInt == 2){
+    partialPath = encodedPartialPath.substr(2);
+  }else{
+    partialPath = encodedPartialPath.substr(1);
+  }
+  if(partialPath == path.substr(pathPtr, partialPath.size())){
+    return partialPath.size();
+  }else{
+    return -1;
+  }
+}
+static bool LegacyVerifyProof(dev::bytesConstRef path,
+                             const dev::RLP& value,
+                             const dev::RLP& parentNodes,
+                             const dev::RLP& root,
+                             std::optional<uint8_t>* envelope_type) {
+
+  dev::RLP currentNode;
+  const int len = parentNodes.itemCount();
+  dev::RLP nodeKey = root;
+  int pathPtr = 0;
+
+  const std::string pathString = dev::toHex(path);
+  int nibbles;
+  char pathPtrInt[2];
+  uint8_t pathInt;
+  for (int i = 0 ; i < len ; i++) {
+    currentNode = parentNodes[i];
+    if(!nodeKey.payload().contentsEqual(sha3(currentNode.data()).ref().toVector())){
+      return false;
+    }
+
+    if(pathPtr > (int)pathString.size()){
+      return false;
+    }
+    switch(currentNode.itemCount()){
+      case 17://branch node
+        if(pathPtr == (int)pathString.size()){
+          // RLP-encoded transaction/receipt indexes are prefix-free, so
+          // canonical Ethereum tries terminate these proofs at leaf nodes.
+          // Keep generic MPT branch-value handling consistent with leaves.
+          return LegacyMatchProofValue(currentNode[16].toBytes(), value, envelope_type);
+        }
+        pathPtrInt[0] = pathString[pathPtr];
+        pathPtrInt[1] = '\0';
+        if(!ParseUInt8FromHex(pathPtrInt, &pathInt)) {
+          return false;
+        }
+        nodeKey = currentNode[pathInt]; //must == sha3(rlp.encode(currentNode[path[pathptr]]))
+        pathPtr += 1;
+        break;
+      case 2:
+        {
+        if(!currentNode[0].isData()) {
+          return false;
+        }
+        const dev::bytes compact = currentNode[0].toBytes();
+        if(compact.empty()) {
+          return false;
+        }
+        // HP compact encoding (Yellow Paper / Geth):
+        // high nibble 0/1 = extension, 2/3 = leaf; low bit = odd path length.
+        // Do not infer leaf vs extension from path exhaustion alone.
+        const uint8_t hp_flag = compact[0] >> 4;
+        if(hp_flag > 3) {
+          return false;
+        }
+        const bool is_odd = (hp_flag & 1) != 0;
+        const bool is_leaf = (hp_flag & 2) != 0;
+        // Even HP encoding requires a zero padding nibble.
+        if(!is_odd && (compact[0] & 0x0f) != 0) {
+          return false;
+        }
+        // Geth does not emit empty extension paths (shared prefix length 0
+        // becomes a branch). Reject that noncanonical shape.
+        if(!is_leaf && !is_odd && compact.size() == 1) {
+          return false;
+        }
+        const std::string encodedPartialPath = toHex(
+            dev::bytesConstRef(compact.data(), compact.size()));
+        nibbles = LegacyNibblesToTraverse(encodedPartialPath, pathString, pathPtr);
+        if(nibbles <= -1) {
+          return false;
+        }
+        pathPtr += nibbles;
+        if(is_leaf) {
+          if(pathPtr != (int)pathString.size()) {
+            return false;
+          }
+          dev::bytes nodeVec(currentNode[1].toBytes());
+          return LegacyMatchProofValue(std::move(nodeVec), value, envelope_type);
+        }
+        // Extension: follow the child. After a nonempty extension the remaining
+        // path may be empty when the child is a branch value slot.
+        nodeKey = currentNode[1];
+        }
+        break;
+      default:
+        return false;
+    }
+  }
+
+  return false;
+}
+
+struct MintProof {
+    std::vector<unsigned char> vchRoot{ParseHex(MINT_PROOF_ROOT)};
+    std::vector<unsigned char> vchParentNodes{ParseHex(MINT_PROOF_PARENT_NODES)};
+    std::vector<unsigned char> vchValue{ParseHex(MINT_PROOF_VALUE)};
+    std::vector<unsigned char> vchPath{ParseHex(MINT_PROOF_PATH)};
+};
+} // namespace
+
+static void NEVMVerifyProof(benchmark::Bench& bench)
+{
+    const MintProof proof;
+    const dev::RLP rlpRoot(&proof.vchRoot);
+    const dev::RLP rlpParentNodes(&proof.vchParentNodes);
+    const dev::RLP rlpValue(&proof.vchValue);
+    const dev::bytesConstRef path(proof.vchPath.data(), proof.vchPath.size());
+    bench.unit("proof").run([&] {
+        std::optional<uint8_t> envelope_type;
+        const bool ok = VerifyProof(path, rlpValue, rlpParentNodes, rlpRoot, &envelope_type);
+        assert(ok);
+    });
+}
+
+static void NEVMVerifyProofLegacy(benchmark::Bench& bench)
+{
+    const MintProof proof;
+    const dev::RLP rlpRoot(&proof.vchRoot);
+    const dev::RLP rlpParentNodes(&proof.vchParentNodes);
+    const dev::RLP rlpValue(&proof.vchValue);
+    const dev::bytesConstRef path(proof.vchPath.data(), proof.vchPath.size());
+    bench.unit("proof").run([&] {
+        std::optional<uint8_t> envelope_type;
+        const bool ok = LegacyVerifyProof(path, rlpValue, rlpParentNodes, rlpRoot, &envelope_type);
+        assert(ok);
+    });
+}
+
+BENCHMARK(NEVMVerifyProof, benchmark::PriorityLevel::HIGH);
+BENCHMARK(NEVMVerifyProofLegacy, benchmark::PriorityLevel::HIGH);
@@ -11,6 +11,7 @@
 #include <crypto/siphash.h>
 #include <logging.h>
 #include <random.h>
+#include <services/nevmconsensus.h>
 #include <streams.h>
 #include <txmempool.h>
 #include <validation.h>
@@ -26,6 +27,16 @@ CBlockHeaderAndShortTxIDs::CBlockHeaderAndShortTxIDs(const CBlock& block, bool f
     for (size_t i = 1; i < block.vtx.size(); i++) {
         const CTransaction& tx = *block.vtx[i];
         shorttxids[i - 1] = GetShortID(tx.GetWitnessHash());
+        // SYSCOIN
+        if (tx.IsNEVMData()) {
+            const int nOut = GetSyscoinDataOutput(tx);
+            if (nOut != -1) {
+                CNEVMData nevmData(tx.vout[nOut].scriptPubKey);
+                if (!nevmData.IsNull()) {
+                    nevmdatarefs.push_back({static_cast<uint16_t>(i), std::move(nevmData.vchVersionHash)});
+                }
+            }
+        }
     }
     // SYSCOIN
     CBlock& blockRef = const_cast<CBlock&>(block);
@@ -54,6 +65,25 @@ uint64_t CBlockHeaderAndShortTxIDs::GetShortID(const uint256& txhash) const {
     return SipHashUint256(shorttxidk0, shorttxidk1, txhash) & 0xffffffffffffL;
 }
 
+// SYSCOIN
+CTransactionRef StripNEVMData(const CTransactionRef& tx)
+{
+    const int nOut = GetSyscoinDataOutput(*tx);
+    if (nOut == -1 || tx->vout[nOut].vchNEVMData.empty()) {
+        return tx;
+    }
+    // rebuild the outputs rather than copying the transaction, so the blob itself is never copied
+    CMutableTransaction mtx;
+    mtx.nVersion = tx->nVersion;
+    mtx.nLockTime = tx->nLockTime;
+    mtx.vin = tx->vin;
+    mtx.vout.reserve(tx->vout.size());
+    for (const auto& txout : tx->vout) {
+        mtx.vout.emplace_back(txout.nValue, txout.scriptPubKey, txout.assetInfo);
+    }
+    return MakeTransactionRef(std::move(mtx));
+}
+
 
 
 ReadStatus PartiallyDownloadedBlock::InitData(CBlockHeaderAndShortTxIDs& cmpctblock, const std::vector<std::pair<uint256, CTransactionRef>>& extra_txn) {
@@ -61,6 +91,13 @@ ReadStatus PartiallyDownloadedBlock::InitData(CBlockHeaderAndShortTxIDs& cmpctbl
         return READ_STATUS_INVALID;
     if (cmpctblock.shorttxids.size() + cmpctblock.prefilledtxn.size() > MAX_BLOCK_WEIGHT / MIN_SERIALIZABLE_TRANSACTION_WEIGHT)
         return READ_STATUS_INVALID;
+    // SYSCOIN
+    if (cmpctblock.nevmdatarefs.size() > MAX_DATA_BLOBS)
+        return READ_STATUS_INVALID;
+    for (const auto& ref : cmpctblock.nevmdatarefs) {
+        if (ref.index == 0 || ref.index >= cmpctblock.BlockTxCount() || ref.vchVersionHash.size() != NEVM_DATA_LEGACY_VERSIONHASH_SIZE)
+            return READ_STATUS_INVALID;
+    }
 
     if (!header.IsNull() || !txn_available.empty()) return READ_STATUS_INVALID;
 
@@ -172,7 +209,16 @@ ReadStatus PartiallyDownloadedBlock::InitData(CBlockHeaderAndShortTxIDs& cmpctbl
         if (mempool_count == shorttxids.size())
             break;
     }
-    // SYSCOIN
+    // SYSCOIN blob transactions we could not find can still be fetched without the blob if we store it already
+    blob_available.resize(txn_available.size());
+    if (pnevmdatablobdb) {
+        for (const auto& ref : cmpctblock.nevmdatarefs) {
+            if (!txn_available[ref.index] && !blob_available[ref.index] && pnevmdatablobdb->Exists(ref.vchVersionHash)) {
+                blob_available[ref.index] = true;
+                blob_count++;
+            }
+        }
+    }
     if(!cmpctblock.vchNEVMBlockData.empty()) {
         vchNEVMBlockData = std::move(cmpctblock.vchNEVMBlockData);
     }
@@ -190,6 +236,14 @@ bool PartiallyDownloadedBlock::IsTxAvailable(size_t index) const
     return txn_available[index] != nullptr;
 }
 
+bool PartiallyDownloadedBlock::IsBlobAvailable(size_t index) const
+{
+    if (header.IsNull()) return false;
+
+    assert(index < blob_available.size());
+    return blob_available[index];
+}
+
 ReadStatus PartiallyDownloadedBlock::FillBlock(CBlock& block, const std::vector<CTransactionRef>& vtx_missing)
 {
     if (header.IsNull()) return READ_STATUS_INVALID;
@@ -214,6 +268,16 @@ ReadStatus PartiallyDownloadedBlock::FillBlock(CBlock& block, const std::vector<
     if (vtx_missing.size() != tx_missing_offset)
         return READ_STATUS_INVALID;
 
+    // SYSCOIN put back the blobs of transactions that were sent without them, falling back
+    // to a full block request if one of them went missing from the blob store in the meantime
+    const std::vector<bool> blobs_to_fill{std::move(blob_available)};
+    blob_available.clear();
+    for (size_t i = 0; i < blobs_to_fill.size(); i++) {
+        bool fHasData{false};
+        if (blobs_to_fill[i] && (!FillNEVMData(block.vtx[i], fHasData) || !fHasData))
+            return READ_STATUS_FAILED;
+    }
+
     // SYSCOIN
     if(!vchNEVMBlockData.empty() && block.vchNEVMBlockData.empty())
         block.vchNEVMBlockData = std::move(vchNEVMBlockData);
@@ -231,7 +295,7 @@ ReadStatus PartiallyDownloadedBlock::FillBlock(CBlock& block, const std::vector<
         return READ_STATUS_CHECKBLOCK_FAILED;
     }
 
-    LogPrint(BCLog::CMPCTBLOCK, "Successfully reconstructed block %s with %lu txn prefilled, %lu txn from mempool (incl at least %lu from extra pool) and %lu txn requested\n", hash.ToString(), prefilled_count, mempool_count, extra_count, vtx_missing.size());
+    LogPrint(BCLog::CMPCTBLOCK, "Successfully reconstructed block %s with %lu txn prefilled, %lu txn from mempool (incl at least %lu from extra pool) and %lu txn requested (%lu without their blob)\n", hash.ToString(), prefilled_count, mempool_count, extra_count, vtx_missing.size(), blob_count);
     if (vtx_missing.size() < 5) {
         for (const auto& tx : vtx_missing) {
             LogPrint(BCLog::CMPCTBLOCK, "Reconstructed block %s required tx %s\n", hash.ToString(), tx->GetHash().ToString());
@@ -6,6 +6,7 @@
 #define SYSCOIN_BLOCKENCODINGS_H
 
 #include <primitives/block.h>
+#include <version.h>
 namespace node {
 class BlockManager;
 } // namespace node
@@ -49,9 +50,14 @@ public:
     // A BlockTransactionsRequest message
     uint256 blockhash;
     std::vector<uint16_t> indexes;
+    // SYSCOIN subset of indexes whose PoDA blob the requester stores already, sent without the blob
+    std::vector<uint16_t> nevm_stripped_indexes;
     SERIALIZE_METHODS(BlockTransactionsRequest, obj)
     {
         READWRITE(obj.blockhash, Using<VectorFormatter<DifferenceFormatter>>(obj.indexes));
+        if (s.GetVersion() >= PODA_COMPACT_BLOCKS_VERSION) {
+            READWRITE(Using<VectorFormatter<DifferenceFormatter>>(obj.nevm_stripped_indexes));
+        }
     }
 };
 
@@ -82,6 +88,18 @@ struct PrefilledTransaction {
     SERIALIZE_METHODS(PrefilledTransaction, obj) { READWRITE(COMPACTSIZE(obj.index), Using<TransactionCompression>(obj.tx)); }
 };
 
+// SYSCOIN
+/** Version hash of a PoDA blob transaction in a compact block, at its index in the block */
+struct NEVMDataRef {
+    uint16_t index;
+    std::vector<uint8_t> vchVersionHash;
+
+    SERIALIZE_METHODS(NEVMDataRef, obj) { READWRITE(COMPACTSIZE(obj.index), obj.vchVersionHash); }
+};
+
+/** Copy of a PoDA blob transaction without its blob, for peers that store the blob already */
+CTransactionRef StripNEVMData(const CTransactionRef& tx);
+
 typedef enum ReadStatus_t
 {
     READ_STATUS_OK,
@@ -108,6 +126,7 @@ public:
     static constexpr int SHORTTXIDS_LENGTH = 6;
     // SYSCOIN
     std::vector<unsigned char> vchNEVMBlockData{};
+    std::vector<NEVMDataRef> nevmdatarefs;
     CBlockHeader header;
 
     // Dummy for deserialization
@@ -122,6 +141,10 @@ public:
     SERIALIZE_METHODS(CBlockHeaderAndShortTxIDs, obj)
     {
         READWRITE(obj.header, obj.nonce, Using<VectorFormatter<CustomUintFormatter<SHORTTXIDS_LENGTH>>>(obj.shorttxids), obj.prefilledtxn, obj.vchNEVMBlockData);
+        // SYSCOIN
+        if (s.GetVersion() >= PODA_COMPACT_BLOCKS_VERSION) {
+            READWRITE(obj.nevmdatarefs);
+        }
         if (ser_action.ForRead()) {
             if (obj.BlockTxCount() > std::numeric_limits<uint16_t>::max()) {
                 throw std::ios_base::failure("indexes overflowed 16 bits");
@@ -133,7 +156,9 @@ public:
 class PartiallyDownloadedBlock {
 protected:
     std::vector<CTransactionRef> txn_available;
-    size_t prefilled_count = 0, mempool_count = 0, extra_count = 0;
+    // SYSCOIN missing transactions whose PoDA blob is in our blob store
+    std::vector<bool> blob_available;
+    size_t prefilled_count = 0, mempool_count = 0, extra_count = 0, blob_count = 0;
     const CTxMemPool* pool;
 public:
     CBlockHeader header;
@@ -149,6 +174,8 @@ public:
     // extra_txn is a list of extra transactions to look at, in <witness hash, reference> form
     ReadStatus InitData(CBlockHeaderAndShortTxIDs& cmpctblock, const std::vector<std::pair<uint256, CTransactionRef>>& extra_txn);
     bool IsTxAvailable(size_t index) const;
+    // SYSCOIN whether the missing transaction at index may be sent without its PoDA blob
+    bool IsBlobAvailable(size_t index) const;
     ReadStatus FillBlock(CBlock& block, const std::vector<CTransactionRef>& vtx_missing);
 };
 
@@ -6,6 +6,7 @@
 #define SYSCOIN_BLS_BLS_BATCHVERIFIER_H
 
 #include <bls/bls.h>
+#include <span.h>
 
 #include <map>
 #include <vector>
@@ -24,6 +25,7 @@ private:
     using MessageMap = std::map<MessageId, Message>;
     using MessageMapIterator = typename MessageMap::iterator;
     using MessagesBySourceMap = std::map<SourceId, std::vector<MessageMapIterator>>;
+    using SourceMapIterator = typename MessagesBySourceMap::iterator;
 
     bool secureVerification;
     bool perMessageFallback;
@@ -81,45 +83,79 @@ public:
             return;
         }
 
-        // revert to per-source verification
-        for (const auto& p : messagesBySource) {
-            bool batchValid = false;
+        // Isolate the bad sources by bisection, a failing group of sources is split in halves until the bad ones are
+        // left. A single bad source among n costs O(log n) batch verifications instead of one per source
+        std::vector<SourceMapIterator> sources;
+        sources.reserve(messagesBySource.size());
+        for (auto it = messagesBySource.begin(); it != messagesBySource.end(); ++it) {
+            sources.emplace_back(it);
+        }
+        // no need to verify it again, we know the full set is invalid
+        BisectSources(sources, true);
+    }
 
-            // no need to verify it again if there was just one source
-            if (messagesBySource.size() != 1) {
-                byMessageHash.clear();
-                for (auto it = p.second.begin(); it != p.second.end(); ++it) {
-                    byMessageHash[(*it)->second.msgHash].emplace_back(*it);
-                }
-                batchValid = VerifyBatch(byMessageHash);
+private:
+    void BisectSources(Span<const SourceMapIterator> sources, bool knownBad)
+    {
+        if (!knownBad) {
+            std::vector<MessageMapIterator> msgIts;
+            for (const auto& sourceIt : sources) {
+                msgIts.insert(msgIts.end(), sourceIt->second.begin(), sourceIt->second.end());
+            }
+            if (VerifyMessages(msgIts)) {
+                return;
             }
-            if (!batchValid) {
-                badSources.emplace(p.first);
-
-                if (perMessageFallback) {
-                    // revert to per-message verification
-                    if (p.second.size() == 1) {
-                        // no need to re-verify a single message
-                        badMessages.emplace(p.second[0]->second.msgId);
-                    } else {
-                        for (const auto& msgIt : p.second) {
-                            if (badMessages.count(msgIt->first)) {
-                                // same message might be invalid from different source, so no need to re-verify it
-                                continue;
-                            }
-
-                            const auto& msg = msgIt->second;
-                            if (!msg.sig.VerifyInsecure(msg.pubKey, msg.msgHash)) {
-                                badMessages.emplace(msg.msgId);
-                            }
-                        }
+        }
+        if (sources.size() == 1) {
+            badSources.emplace(sources[0]->first);
+            if (perMessageFallback) {
+                // same message might be invalid from different source, so no need to re-verify it
+                std::vector<MessageMapIterator> msgIts;
+                for (const auto& msgIt : sources[0]->second) {
+                    if (!badMessages.count(msgIt->first)) {
+                        msgIts.emplace_back(msgIt);
                     }
                 }
+                if (!msgIts.empty()) {
+                    BisectMessages(msgIts, msgIts.size() == sources[0]->second.size());
+                }
             }
+            return;
         }
+        // both halves are verified, the aggregate of one valid half does not prove the other one invalid as duplicate
+        // messages are only counted once per batch
+        const size_t half = sources.size() / 2;
+        BisectSources(sources.first(half), false);
+        BisectSources(sources.subspan(half), false);
+    }
+
+    void BisectMessages(Span<const MessageMapIterator> msgIts, bool knownBad)
+    {
+        if (!knownBad && VerifyMessages(msgIts)) {
+            return;
+        }
+        if (msgIts.size() == 1) {
+            badMessages.emplace(msgIts[0]->second.msgId);
+            return;
+        }
+        const size_t half = msgIts.size() / 2;
+        BisectMessages(msgIts.first(half), false);
+        BisectMessages(msgIts.subspan(half), false);
+    }
+
+    bool VerifyMessages(Span<const MessageMapIterator> msgIts)
+    {
+        if (msgIts.size() == 1) {
+            const auto& msg = msgIts[0]->second;
+            return msg.sig.VerifyInsecure(msg.pubKey, msg.msgHash);
+        }
+        std::map<uint256, std::vector<MessageMapIterator>> byMessageHash;
+        for (const auto& msgIt : msgIts) {
+            byMessageHash[msgIt->second.msgHash].emplace_back(msgIt);
+        }
+        return VerifyBatch(byMessageHash);
     }
 
-private:
     // All Verify methods take ownership of the passed byMessageHash map and thus might modify the map. This is to avoid
     // unnecessary copies
 
@@ -6,6 +6,7 @@
 #define SYSCOIN_BLS_BLS_WORKER_H
 
 #include <bls/bls.h>
+#include <bls/bls_batchverifier.h>
 
 #include <ctpl_stl.h>
 
@@ -125,6 +126,20 @@ public:
     std::future<bool> AsyncVerifySig(const CBLSSignature& sig, const CBLSPublicKey& pubKey, const uint256& msgHash, CancelCond cancelCond = [] { return false; });
     bool IsAsyncVerifyInProgress();
 
+    // Runs a batch verifier on the worker pool, or inline when the pool is not started. The verifier must stay alive
+    // until the returned future is ready
+    template<typename SourceId, typename MessageId>
+    std::future<void> AsyncVerifyBatch(CBLSBatchVerifier<SourceId, MessageId>& batchVerifier)
+    {
+        if (workerPool.size() == 0) {
+            std::promise<void> p;
+            batchVerifier.Verify();
+            p.set_value();
+            return p.get_future();
+        }
+        return workerPool.push([&batchVerifier](int threadId) { batchVerifier.Verify(); });
+    }
+
 private:
     void PushSigVerifyBatch();
 };
@@ -0,0 +1,409 @@
+// Copyright (c) 2024 The Syscoin Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <crypto/multihash.h>
+
+#include <compat/cpuid.h>
+#include <crypto/common.h>
+#include <crypto/sha3.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+namespace multihash_avx2
+{
+void KeccakAbsorb_4way(uint64_t (*st)[25], const unsigned char* const* in, size_t blocks);
+void Blake2sCompress_8way(uint32_t (*h)[8], uint64_t* t, const unsigned char* const* in, size_t blocks, bool last);
+}
+
+namespace multihash_avx512
+{
+void KeccakAbsorb_8way(uint64_t (*st)[25], const unsigned char* const* in, size_t blocks);
+void Blake2sCompress_16way(uint32_t (*h)[8], uint64_t* t, const unsigned char* const* in, size_t blocks, bool last);
+}
+
+// Internal implementation code.
+namespace
+{
+/** Keccak-256 absorbs 136 bytes per permutation. */
+constexpr size_t KECCAK_RATE = 136;
+constexpr size_t BLAKE2S_BLOCK = 64;
+constexpr size_t MAX_KECCAK_LANES = 8;
+constexpr size_t MAX_BLAKE2S_LANES = 16;
+
+/// Internal Keccak-256 implementation.
+namespace keccak
+{
+/** Absorb a number of whole rate-sized blocks into the state. */
+void Absorb(uint64_t (&st)[25], const unsigned char* in, size_t blocks)
+{
+    while (blocks--) {
+        for (size_t i = 0; i < KECCAK_RATE / 8; ++i) {
+            st[i] ^= ReadLE64(in + 8 * i);
+        }
+        KeccakF(st);
+        in += KECCAK_RATE;
+    }
+}
+
+/** Build the final, padded block out of whatever does not fill a whole block. */
+void FillTail(unsigned char (&tail)[KECCAK_RATE], Span<const unsigned char> in)
+{
+    const size_t rem = in.size() % KECCAK_RATE;
+    std::memset(tail, 0, sizeof(tail));
+    if (rem) std::memcpy(tail, in.data() + in.size() - rem, rem);
+    tail[rem] ^= 0x01;
+    tail[KECCAK_RATE - 1] ^= 0x80;
+}
+
+void Hash(unsigned char* out, Span<const unsigned char> in)
+{
+    uint64_t st[25] = {0};
+    unsigned char tail[KECCAK_RATE];
+    Absorb(st, in.data(), in.size() / KECCAK_RATE);
+    FillTail(tail, in);
+    Absorb(st, tail, 1);
+    for (int i = 0; i < 4; ++i) {
+        WriteLE64(out + 8 * i, st[i]);
+    }
+}
+} // namespace keccak
+
+/// Internal BLAKE2s-256 implementation.
+namespace blake2s
+{
+const uint32_t IV[8] = {
+    0x6A09E667ul, 0xBB67AE85ul, 0x3C6EF372ul, 0xA54FF53Aul,
+    0x510E527Ful, 0x9B05688Cul, 0x1F83D9ABul, 0x5BE0CD19ul,
+};
+
+const uint8_t SIGMA[10][16] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+    {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+    {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+    {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+    {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+    {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+    {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+    {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+    {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+};
+
+uint32_t inline Ror(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+void inline G(uint32_t& a, uint32_t& b, uint32_t& c, uint32_t& d, uint32_t x, uint32_t y)
+{
+    a = a + b + x;
+    d = Ror(d ^ a, 16);
+    c = c + d;
+    b = Ror(b ^ c, 12);
+    a = a + b + y;
+    d = Ror(d ^ a, 8);
+    c = c + d;
+    b = Ror(b ^ c, 7);
+}
+
+/** Initialize the state for an unkeyed 32-byte digest. */
+void Initialize(uint32_t (&h)[8])
+{
+    std::copy(IV, IV + 8, h);
+    h[0] ^= 0x01010020;
+}
+
+/** Compress one block; t is the total number of message bytes up to and including this block. */
+void Compress(uint32_t (&h)[8], uint64_t t, const unsigned char* block, bool last)
+{
+    uint32_t m[16];
+    uint32_t v[16];
+    for (int i = 0; i < 16; ++i) {
+        m[i] = ReadLE32(block + 4 * i);
+    }
+    std::copy(h, h + 8, v);
+    std::copy(IV, IV + 8, v + 8);
+    v[12] ^= (uint32_t)t;
+    v[13] ^= (uint32_t)(t >> 32);
+    if (last) v[14] = ~v[14];
+    for (int r = 0; r < 10; ++r) {
+        const uint8_t* s = SIGMA[r];
+        G(v[0], v[4], v[8], v[12], m[s[0]], m[s[1]]);
+        G(v[1], v[5], v[9], v[13], m[s[2]], m[s[3]]);
+        G(v[2], v[6], v[10], v[14], m[s[4]], m[s[5]]);
+        G(v[3], v[7], v[11], v[15], m[s[6]], m[s[7]]);
+        G(v[0], v[5], v[10], v[15], m[s[8]], m[s[9]]);
+        G(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+        G(v[2], v[7], v[8], v[13], m[s[12]], m[s[13]]);
+        G(v[3], v[4], v[9], v[14], m[s[14]], m[s[15]]);
+    }
+    for (int i = 0; i < 8; ++i) {
+        h[i] ^= v[i] ^ v[i + 8];
+    }
+}
+
+/** The number of blocks compressed before the final one; the final block is never empty unless the message is. */
+size_t inline Blocks(Span<const unsigned char> in) { return in.empty() ? 0 : (in.size() - 1) / BLAKE2S_BLOCK; }
+
+void FillTail(unsigned char (&tail)[BLAKE2S_BLOCK], Span<const unsigned char> in)
+{
+    const size_t rem = in.size() - Blocks(in) * BLAKE2S_BLOCK;
+    std::memset(tail, 0, sizeof(tail));
+    if (rem) std::memcpy(tail, in.data() + in.size() - rem, rem);
+}
+
+void Hash(unsigned char* out, Span<const unsigned char> in)
+{
+    uint32_t h[8];
+    unsigned char tail[BLAKE2S_BLOCK];
+    Initialize(h);
+    const size_t blocks = Blocks(in);
+    for (size_t i = 0; i < blocks; ++i) {
+        Compress(h, (i + 1) * BLAKE2S_BLOCK, in.data() + i * BLAKE2S_BLOCK, false);
+    }
+    FillTail(tail, in);
+    Compress(h, in.size(), tail, true);
+    for (int i = 0; i < 8; ++i) {
+        WriteLE32(out + 4 * i, h[i]);
+    }
+}
+} // namespace blake2s
+
+typedef void (*KeccakAbsorbFn)(uint64_t (*)[25], const unsigned char* const*, size_t);
+typedef void (*Blake2sCompressFn)(uint32_t (*)[8], uint64_t*, const unsigned char* const*, size_t, bool);
+
+KeccakAbsorbFn KeccakAbsorbN = nullptr;
+size_t keccak_lanes = 1;
+Blake2sCompressFn Blake2sCompressN = nullptr;
+size_t blake2s_lanes = 1;
+
+/** Order the inputs by length so the messages sharing a pass need about the same number of blocks. */
+std::vector<size_t> SortByLength(const Span<const unsigned char>* inputs, size_t count)
+{
+    std::vector<size_t> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return inputs[a].size() < inputs[b].size(); });
+    return order;
+}
+
+void Keccak256Lanes(unsigned char* output, const Span<const unsigned char>* inputs, const size_t* order, size_t n)
+{
+    uint64_t st[MAX_KECCAK_LANES][25] = {};
+    unsigned char tail[MAX_KECCAK_LANES][KECCAK_RATE];
+    const unsigned char* data[MAX_KECCAK_LANES];
+    size_t blocks[MAX_KECCAK_LANES];
+    size_t common = SIZE_MAX;
+    for (size_t lane = 0; lane < keccak_lanes; ++lane) {
+        // spare lanes repeat the first message and their result is dropped
+        const Span<const unsigned char> in = inputs[order[lane < n ? lane : 0]];
+        data[lane] = in.data();
+        blocks[lane] = in.size() / KECCAK_RATE;
+        common = std::min(common, blocks[lane]);
+        keccak::FillTail(tail[lane], in);
+    }
+    KeccakAbsorbN(st, data, common);
+    for (size_t lane = 0; lane < keccak_lanes; ++lane) {
+        if (blocks[lane] > common) {
+            keccak::Absorb(st[lane], data[lane] + common * KECCAK_RATE, blocks[lane] - common);
+        }
+        data[lane] = tail[lane];
+    }
+    KeccakAbsorbN(st, data, 1);
+    for (size_t lane = 0; lane < n; ++lane) {
+        for (int i = 0; i < 4; ++i) {
+            WriteLE64(output + 32 * order[lane] + 8 * i, st[lane][i]);
+        }
+    }
+}
+
+void Blake2s256Lanes(unsigned char* output, const Span<const unsigned char>* inputs, const size_t* order, size_t n)
+{
+    uint32_t h[MAX_BLAKE2S_LANES][8];
+    uint64_t t[MAX_BLAKE2S_LANES] = {};
+    unsigned char tail[MAX_BLAKE2S_LANES][BLAKE2S_BLOCK];
+    const unsigned char* data[MAX_BLAKE2S_LANES];
+    size_t blocks[MAX_BLAKE2S_LANES];
+    size_t common = SIZE_MAX;
+    for (size_t lane = 0; lane < blake2s_lanes; ++lane) {
+        const Span<const unsigned char> in = inputs[order[lane < n ? lane : 0]];
+        blake2s::Initialize(h[lane]);
+        data[lane] = in.data();
+        blocks[lane] = blake2s::Blocks(in);
+        common = std::min(common, blocks[lane]);
+        blake2s::FillTail(tail[lane], in);
+    }
+    Blake2sCompressN(h, t, data, common, false);
+    for (size_t lane = 0; lane < blake2s_lanes; ++lane) {
+        for (size_t i = common; i < blocks[lane]; ++i) {
+            t[lane] += BLAKE2S_BLOCK;
+            blake2s::Compress(h[lane], t[lane], data[lane] + i * BLAKE2S_BLOCK, false);
+        }
+        t[lane] = inputs[order[lane < n ? lane : 0]].size();
+        data[lane] = tail[lane];
+    }
+    Blake2sCompressN(h, t, data, 1, true);
+    for (size_t lane = 0; lane < n; ++lane) {
+        for (int i = 0; i < 8; ++i) {
+            WriteLE32(output + 32 * order[lane] + 4 * i, h[lane][i]);
+        }
+    }
+}
+
+bool SelfTest()
+{
+    // Known answers for the empty string and "abc".
+    static const unsigned char keccak_kat[2][32] = {
+        {0xc5, 0xd2, 0x46, 0x01, 0x86, 0xf7, 0x23, 0x3c, 0x92, 0x7e, 0x7d, 0xb2, 0xdc, 0xc7, 0x03, 0xc0,
+         0xe5, 0x00, 0xb6, 0x53, 0xca, 0x82, 0x27, 0x3b, 0x7b, 0xfa, 0xd8, 0x04, 0x5d, 0x85, 0xa4, 0x70},
+        {0x4e, 0x03, 0x65, 0x7a, 0xea, 0x45, 0xa9, 0x4f, 0xc7, 0xd4, 0x7b, 0xa8, 0x26, 0xc8, 0xd6, 0x67,
+         0xc0, 0xd1, 0xe6, 0xe3, 0x3a, 0x64, 0xa0, 0x36, 0xec, 0x44, 0xf5, 0x8f, 0xa1, 0x2d, 0x6c, 0x45},
+    };
+    static const unsigned char blake2s_kat[2][32] = {
+        {0x69, 0x21, 0x7a, 0x30, 0x79, 0x90, 0x80, 0x94, 0xe1, 0x11, 0x21, 0xd0, 0x42, 0x35, 0x4a, 0x7c,
+         0x1f, 0x55, 0xb6, 0x48, 0x2c, 0xa1, 0xa5, 0x1e, 0x1b, 0x25, 0x0d, 0xfd, 0x1e, 0xd0, 0xee, 0xf9},
+        {0x50, 0x8c, 0x5e, 0x8c, 0x32, 0x7c, 0x14, 0xe2, 0xe1, 0xa7, 0x2b, 0xa3, 0x4e, 0xeb, 0x45, 0x2f,
+         0x37, 0x45, 0x8b, 0x20, 0x9e, 0xd6, 0x3a, 0x29, 0x4d, 0x99, 0x9b, 0x4c, 0x86, 0x67, 0x59, 0x82},
+    };
+    // Lengths around both block sizes, more of them than the widest kernel has lanes.
+    static const size_t lengths[] = {0, 3, 63, 64, 65, 128, 135, 136, 137, 200, 271, 272, 273, 300, 407, 408, 409};
+    static constexpr size_t COUNT = sizeof(lengths) / sizeof(lengths[0]);
+    unsigned char data[409];
+    data[0] = 'a';
+    data[1] = 'b';
+    data[2] = 'c';
+    for (size_t i = 3; i < sizeof(data); ++i) {
+        data[i] = (unsigned char)(i * 7 + 1);
+    }
+    Span<const unsigned char> inputs[COUNT];
+    for (size_t i = 0; i < COUNT; ++i) {
+        inputs[i] = Span<const unsigned char>{data, lengths[i]};
+    }
+
+    unsigned char out[COUNT * 32];
+    unsigned char expected[32];
+    Keccak256Multi(out, inputs, COUNT);
+    if (!std::equal(out, out + 32, keccak_kat[0]) || !std::equal(out + 32, out + 64, keccak_kat[1])) return false;
+    for (size_t i = 0; i < COUNT; ++i) {
+        keccak::Hash(expected, inputs[i]);
+        if (!std::equal(expected, expected + 32, out + 32 * i)) return false;
+    }
+    Blake2s256Multi(out, inputs, COUNT);
+    if (!std::equal(out, out + 32, blake2s_kat[0]) || !std::equal(out + 32, out + 64, blake2s_kat[1])) return false;
+    for (size_t i = 0; i < COUNT; ++i) {
+        blake2s::Hash(expected, inputs[i]);
+        if (!std::equal(expected, expected + 32, out + 32 * i)) return false;
+    }
+    return true;
+}
+
+#if defined(USE_ASM) && defined(HAVE_GETCPUID)
+/** Return the OS-enabled register state mask (XCR0). */
+uint32_t XCR0()
+{
+    uint32_t a, d;
+    __asm__("xgetbv" : "=a"(a), "=d"(d) : "c"(0));
+    return a;
+}
+#endif
+} // namespace
+
+
+std::string MultiHashAutoDetect(multihash_implementation::UseImplementation use_implementation)
+{
+    std::string ret = "standard";
+    KeccakAbsorbN = nullptr;
+    keccak_lanes = 1;
+    Blake2sCompressN = nullptr;
+    blake2s_lanes = 1;
+
+#if defined(USE_ASM) && defined(HAVE_GETCPUID)
+    [[maybe_unused]] bool have_avx2 = false;
+    [[maybe_unused]] bool have_avx512 = false;
+    uint32_t xcr0 = 0;
+
+    uint32_t eax, ebx, ecx, edx;
+    GetCPUID(1, 0, eax, ebx, ecx, edx);
+    const bool have_xsave = (ecx >> 27) & 1;
+    const bool have_avx = (ecx >> 28) & 1;
+    if (have_xsave && have_avx) {
+        xcr0 = XCR0();
+    }
+    GetCPUID(7, 0, eax, ebx, ecx, edx);
+    if (use_implementation & multihash_implementation::USE_AVX2) {
+        // YMM state enabled by the OS
+        have_avx2 = ((ebx >> 5) & 1) && (xcr0 & 0x06) == 0x06;
+    }
+    if (use_implementation & multihash_implementation::USE_AVX512) {
+        // YMM, opmask and both halves of the ZMM state enabled by the OS
+        have_avx512 = ((ebx >> 16) & 1) && (xcr0 & 0xe6) == 0xe6;
+    }
+
+#if defined(ENABLE_AVX2) && !defined(BUILD_SYSCOIN_INTERNAL)
+    if (have_avx2) {
+        KeccakAbsorbN = multihash_avx2::KeccakAbsorb_4way;
+        keccak_lanes = 4;
+        Blake2sCompressN = multihash_avx2::Blake2sCompress_8way;
+        blake2s_lanes = 8;
+        ret = "avx2(keccak 4way,blake2s 8way)";
+    }
+#endif
+
+#if defined(ENABLE_AVX512) && !defined(BUILD_SYSCOIN_INTERNAL)
+    if (have_avx512) {
+        KeccakAbsorbN = multihash_avx512::KeccakAbsorb_8way;
+        keccak_lanes = 8;
+        Blake2sCompressN = multihash_avx512::Blake2sCompress_16way;
+        blake2s_lanes = 16;
+        ret = "avx512(keccak 8way,blake2s 16way)";
+    }
+#endif
+#endif // defined(USE_ASM) && defined(HAVE_GETCPUID)
+
+    assert(SelfTest());
+    return ret;
+}
+
+void Keccak256Multi(unsigned char* output, const Span<const unsigned char>* inputs, size_t count)
+{
+    if (!KeccakAbsorbN) {
+        for (size_t i = 0; i < count; ++i) {
+            keccak::Hash(output + 32 * i, inputs[i]);
+        }
+        return;
+    }
+    const std::vector<size_t> order = SortByLength(inputs, count);
+    for (size_t pos = 0; pos < count; pos += keccak_lanes) {
+        const size_t n = std::min(keccak_lanes, count - pos);
+        if (n == 1) {
+            keccak::Hash(output + 32 * order[pos], inputs[order[pos]]);
+        } else {
+            Keccak256Lanes(output, inputs, order.data() + pos, n);
+        }
+    }
+}
+
+void Blake2s256Multi(unsigned char* output, const Span<const unsigned char>* inputs, size_t count)
+{
+    if (!Blake2sCompressN) {
+        for (size_t i = 0; i < count; ++i) {
+            blake2s::Hash(output + 32 * i, inputs[i]);
+        }
+        return;
+    }
+    const std::vector<size_t> order = SortByLength(inputs, count);
+    for (size_t pos = 0; pos < count; pos += blake2s_lanes) {
+        const size_t n = std::min(blake2s_lanes, count - pos);
+        if (n == 1) {
+            blake2s::Hash(output + 32 * order[pos], inputs[order[pos]]);
+        } else {
+            Blake2s256Lanes(output, inputs, order.data() + pos, n);
+        }
+    }
+}
+
+size_t MultiHashLanes()
+{
+    return std::max(keccak_lanes, blake2s_lanes);
+}
@@ -0,0 +1,48 @@
+// Copyright (c) 2024 The Syscoin Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef SYSCOIN_CRYPTO_MULTIHASH_H
+#define SYSCOIN_CRYPTO_MULTIHASH_H
+
+#include <span.h>
+
+#include <cstdlib>
+#include <stdint.h>
+#include <string>
+
+/** Multi-buffer Keccak-256 and BLAKE2s-256 used to verify PoDA blob version hashes.
+ *
+ *  Inputs are hashed several at a time, one message per SIMD lane. Messages are
+ *  grouped by length so the lanes of a pass run in lock-step for as long as
+ *  possible; whatever is left over in a lane is finished with the scalar code.
+ */
+
+namespace multihash_implementation {
+enum UseImplementation : uint8_t {
+    STANDARD = 0,
+    USE_AVX2 = 1 << 0,
+    USE_AVX512 = 1 << 1,
+    USE_ALL = USE_AVX2 | USE_AVX512,
+};
+}
+
+/** Autodetect the best available multi-buffer Keccak-256/BLAKE2s implementation.
+ *  Returns the name of the implementation.
+ */
+std::string MultiHashAutoDetect(multihash_implementation::UseImplementation use_implementation = multihash_implementation::USE_ALL);
+
+/** Compute the Keccak-256 (original Keccak padding, as used by Ethereum) of several messages.
+ *  output:  pointer to a count*32 byte output buffer
+ *  inputs:  pointer to count input messages
+ *  count:   the number of hashes to compute.
+ */
+void Keccak256Multi(unsigned char* output, const Span<const unsigned char>* inputs, size_t count);
+
+/** Compute the unkeyed BLAKE2s-256 of several messages, see Keccak256Multi for the arguments. */
+void Blake2s256Multi(unsigned char* output, const Span<const unsigned char>* inputs, size_t count);
+
+/** The number of messages a single call should be given to fill every lane of the selected kernels. */
+size_t MultiHashLanes();
+
+#endif // SYSCOIN_CRYPTO_MULTIHASH_H
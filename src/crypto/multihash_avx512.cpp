@@ -0,0 +1,208 @@
+// Copyright (c) 2024 The Syscoin Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifdef ENABLE_AVX512
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include <attributes.h>
+#include <crypto/common.h>
+
+namespace multihash_avx512 {
+namespace {
+
+const uint64_t RC[24] = {
+    0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL, 0x8000000080008000ULL,
+    0x000000000000808bULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+    0x000000000000008aULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+    0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+    0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800aULL, 0x800000008000000aULL,
+    0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL,
+};
+
+const uint32_t IV[8] = {
+    0x6A09E667ul, 0xBB67AE85ul, 0x3C6EF372ul, 0xA54FF53Aul,
+    0x510E527Ful, 0x9B05688Cul, 0x1F83D9ABul, 0x5BE0CD19ul,
+};
+
+const uint8_t SIGMA[10][16] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+    {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+    {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+    {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+    {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+    {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+    {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+    {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+    {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+};
+
+__m512i inline Xor(__m512i x, __m512i y) { return _mm512_xor_si512(x, y); }
+__m512i inline Xor3(__m512i x, __m512i y, __m512i z) { return _mm512_ternarylogic_epi64(x, y, z, 0x96); }
+__m512i inline Xor(__m512i a, __m512i b, __m512i c, __m512i d, __m512i e) { return Xor3(Xor3(a, b, c), d, e); }
+/** x ^ (~y & z), the Keccak chi step, as one ternary logic instruction. */
+__m512i inline Chi(__m512i x, __m512i y, __m512i z) { return _mm512_ternarylogic_epi64(x, y, z, 0xD2); }
+template <int N> __m512i inline Rol(__m512i x) { return _mm512_rol_epi64(x, N); }
+template <> __m512i inline Rol<0>(__m512i x) { return x; }
+
+__m512i inline Add(__m512i x, __m512i y) { return _mm512_add_epi32(x, y); }
+__m512i inline Add(__m512i x, __m512i y, __m512i z) { return Add(Add(x, y), z); }
+template <int N> __m512i inline Ror(__m512i x) { return _mm512_ror_epi32(x, N); }
+
+__m512i inline Load(__m512i* p) { return _mm512_load_si512(p); }
+__m512i inline K64(uint64_t x) { return _mm512_set1_epi64(x); }
+__m512i inline K32(uint32_t x) { return _mm512_set1_epi32(x); }
+__m512i inline Ones() { return _mm512_set1_epi32(-1); }
+__m512i inline Zero() { return _mm512_setzero_si512(); }
+void inline Store(__m512i* p, __m512i x) { _mm512_store_si512(p, x); }
+
+/** Keccak-f[1600] over 8 independent states. */
+void ALWAYS_INLINE KeccakF(__m512i (&A)[25])
+{
+    __m512i B[25], C[5], D[5];
+    for (int round = 0; round < 24; ++round) {
+        // Theta
+        for (int x = 0; x < 5; ++x) {
+            C[x] = Xor(A[x], A[x + 5], A[x + 10], A[x + 15], A[x + 20]);
+        }
+        for (int x = 0; x < 5; ++x) {
+            D[x] = Xor(C[(x + 4) % 5], Rol<1>(C[(x + 1) % 5]));
+        }
+        for (int i = 0; i < 25; ++i) {
+            A[i] = Xor(A[i], D[i % 5]);
+        }
+        // Rho and pi
+        B[0] = Rol<0>(A[0]);
+        B[10] = Rol<1>(A[1]);
+        B[20] = Rol<62>(A[2]);
+        B[5] = Rol<28>(A[3]);
+        B[15] = Rol<27>(A[4]);
+        B[16] = Rol<36>(A[5]);
+        B[1] = Rol<44>(A[6]);
+        B[11] = Rol<6>(A[7]);
+        B[21] = Rol<55>(A[8]);
+        B[6] = Rol<20>(A[9]);
+        B[7] = Rol<3>(A[10]);
+        B[17] = Rol<10>(A[11]);
+        B[2] = Rol<43>(A[12]);
+        B[12] = Rol<25>(A[13]);
+        B[22] = Rol<39>(A[14]);
+        B[23] = Rol<41>(A[15]);
+        B[8] = Rol<45>(A[16]);
+        B[18] = Rol<15>(A[17]);
+        B[3] = Rol<21>(A[18]);
+        B[13] = Rol<8>(A[19]);
+        B[14] = Rol<18>(A[20]);
+        B[24] = Rol<2>(A[21]);
+        B[9] = Rol<61>(A[22]);
+        B[19] = Rol<56>(A[23]);
+        B[4] = Rol<14>(A[24]);
+        // Chi
+        for (int y = 0; y < 25; y += 5) {
+            for (int x = 0; x < 5; ++x) {
+                A[y + x] = Chi(B[y + x], B[y + (x + 1) % 5], B[y + (x + 2) % 5]);
+            }
+        }
+        // Iota
+        A[0] = Xor(A[0], K64(RC[round]));
+    }
+}
+
+/** One BLAKE2s quarter round on 16 independent states. */
+void ALWAYS_INLINE G(__m512i& a, __m512i& b, __m512i& c, __m512i& d, __m512i x, __m512i y)
+{
+    a = Add(a, b, x);
+    d = Ror<16>(Xor(d, a));
+    c = Add(c, d);
+    b = Ror<12>(Xor(b, c));
+    a = Add(a, b, y);
+    d = Ror<8>(Xor(d, a));
+    c = Add(c, d);
+    b = Ror<7>(Xor(b, c));
+}
+
+} // namespace
+
+void KeccakAbsorb_8way(uint64_t (*st)[25], const unsigned char* const* in, size_t blocks)
+{
+    if (!blocks) return;
+    alignas(64) uint64_t lanes[8];
+    __m512i A[25];
+    for (int i = 0; i < 25; ++i) {
+        for (int l = 0; l < 8; ++l) lanes[l] = st[l][i];
+        A[i] = Load((__m512i*)lanes);
+    }
+    const unsigned char* p[8];
+    for (int l = 0; l < 8; ++l) p[l] = in[l];
+    while (blocks--) {
+        for (int i = 0; i < 17; ++i) {
+            for (int l = 0; l < 8; ++l) lanes[l] = ReadLE64(p[l] + 8 * i);
+            A[i] = Xor(A[i], Load((__m512i*)lanes));
+        }
+        KeccakF(A);
+        for (int l = 0; l < 8; ++l) p[l] += 136;
+    }
+    for (int i = 0; i < 25; ++i) {
+        Store((__m512i*)lanes, A[i]);
+        for (int l = 0; l < 8; ++l) st[l][i] = lanes[l];
+    }
+}
+
+void Blake2sCompress_16way(uint32_t (*h)[8], uint64_t* t, const unsigned char* const* in, size_t blocks, bool last)
+{
+    if (!blocks) return;
+    alignas(64) uint32_t lanes[16];
+    __m512i H[8], M[16], V[16];
+    for (int i = 0; i < 8; ++i) {
+        for (int l = 0; l < 16; ++l) lanes[l] = h[l][i];
+        H[i] = Load((__m512i*)lanes);
+    }
+    const __m512i f = last ? Ones() : Zero();
+    const unsigned char* p[16];
+    for (int l = 0; l < 16; ++l) p[l] = in[l];
+    while (blocks--) {
+        // the counter covers every byte up to and including this block; the caller sets it for the last one
+        if (!last) {
+            for (int l = 0; l < 16; ++l) t[l] += 64;
+        }
+        for (int i = 0; i < 16; ++i) {
+            for (int l = 0; l < 16; ++l) lanes[l] = ReadLE32(p[l] + 4 * i);
+            M[i] = Load((__m512i*)lanes);
+        }
+        for (int i = 0; i < 8; ++i) {
+            V[i] = H[i];
+            V[i + 8] = K32(IV[i]);
+        }
+        for (int l = 0; l < 16; ++l) lanes[l] = (uint32_t)t[l];
+        V[12] = Xor(V[12], Load((__m512i*)lanes));
+        for (int l = 0; l < 16; ++l) lanes[l] = (uint32_t)(t[l] >> 32);
+        V[13] = Xor(V[13], Load((__m512i*)lanes));
+        V[14] = Xor(V[14], f);
+        for (int r = 0; r < 10; ++r) {
+            const uint8_t* s = SIGMA[r];
+            G(V[0], V[4], V[8], V[12], M[s[0]], M[s[1]]);
+            G(V[1], V[5], V[9], V[13], M[s[2]], M[s[3]]);
+            G(V[2], V[6], V[10], V[14], M[s[4]], M[s[5]]);
+            G(V[3], V[7], V[11], V[15], M[s[6]], M[s[7]]);
+            G(V[0], V[5], V[10], V[15], M[s[8]], M[s[9]]);
+            G(V[1], V[6], V[11], V[12], M[s[10]], M[s[11]]);
+            G(V[2], V[7], V[8], V[13], M[s[12]], M[s[13]]);
+            G(V[3], V[4], V[9], V[14], M[s[14]], M[s[15]]);
+        }
+        for (int i = 0; i < 8; ++i) {
+            H[i] = Xor(H[i], Xor(V[i], V[i + 8]));
+        }
+        for (int l = 0; l < 16; ++l) p[l] += 64;
+    }
+    for (int i = 0; i < 8; ++i) {
+        Store((__m512i*)lanes, H[i]);
+        for (int l = 0; l < 16; ++l) h[l][i] = lanes[l];
+    }
+}
+
+} // namespace multihash_avx512
+
+#endif
@@ -454,6 +454,9 @@ CDBIterator::~CDBIterator() = default;
 bool CDBIterator::Valid() const { return m_impl_iter->iter->Valid(); }
 void CDBIterator::SeekToFirst() { m_impl_iter->iter->SeekToFirst(); }
 void CDBIterator::Next() { m_impl_iter->iter->Next(); }
+// SYSCOIN
+void CDBIterator::SeekToLast() { m_impl_iter->iter->SeekToLast(); }
+void CDBIterator::Prev() { m_impl_iter->iter->Prev(); }
 
 namespace dbwrapper_private {
 
@@ -145,6 +145,8 @@ public:
     bool Valid() const;
 
     void SeekToFirst();
+    // SYSCOIN
+    void SeekToLast();
 
     template<typename K> void Seek(const K& key) {
         DataStream ssKey{};
@@ -154,6 +156,8 @@ public:
     }
 
     void Next();
+    // SYSCOIN
+    void Prev();
 
     template<typename K> bool GetKey(K& key) {
         try {
@@ -637,6 +637,22 @@ void HTTPRequest::WriteHeader(const std::string& hdr, const std::string& value)
  * Replies must be sent in the main loop in the main http thread,
  * this cannot be done from worker threads.
  */
+// SYSCOIN
+void HTTPRequest::AppendReplyReference(Span<const std::byte> data, std::shared_ptr<const void> owner)
+{
+    assert(!replySent && req);
+    if (data.empty()) return;
+    struct evbuffer* evb = evhttp_request_get_output_buffer(req);
+    assert(evb);
+    // released by libevent once the referenced bytes are drained or the request is freed
+    auto* holder = new std::shared_ptr<const void>(std::move(owner));
+    const auto cleanup = [](const void*, size_t, void* extra) { delete static_cast<std::shared_ptr<const void>*>(extra); };
+    if (evbuffer_add_reference(evb, data.data(), data.size(), cleanup, holder) != 0) {
+        delete holder;
+        evbuffer_add(evb, data.data(), data.size());
+    }
+}
+
 void HTTPRequest::WriteReply(int nStatus, const std::string& strReply)
 {
     assert(!replySent && req);
@@ -5,7 +5,10 @@
 #ifndef SYSCOIN_HTTPSERVER_H
 #define SYSCOIN_HTTPSERVER_H
 
+#include <span.h>
+
 #include <functional>
+#include <memory>
 #include <optional>
 #include <string>
 
@@ -115,6 +118,15 @@ public:
      */
     void WriteHeader(const std::string& hdr, const std::string& value);
 
+    // SYSCOIN
+    /**
+     * Append data to the reply body without copying it.
+     * owner keeps the memory behind data alive until the bytes have been sent.
+     *
+     * @note call this before WriteReply, whose body is appended after any referenced data.
+     */
+    void AppendReplyReference(Span<const std::byte> data, std::shared_ptr<const void> owner);
+
     /**
      * Write HTTP reply.
      * nStatus is the HTTP status code to send.
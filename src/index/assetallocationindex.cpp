@@ -0,0 +1,192 @@
+// Copyright (c) 2024 The Syscoin Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <index/assetallocationindex.h>
+
+#include <logging.h>
+#include <node/blockstorage.h>
+#include <serialize.h>
+#include <undo.h>
+#include <validation.h>
+
+#include <map>
+
+static constexpr uint8_t DB_BALANCE{'b'};
+static constexpr uint8_t DB_HISTORY{'h'};
+
+namespace {
+
+template <typename Stream>
+void WriteAssetBE(Stream& s, uint64_t asset)
+{
+    ser_writedata32be(s, static_cast<uint32_t>(asset >> 32));
+    ser_writedata32be(s, static_cast<uint32_t>(asset));
+}
+
+template <typename Stream>
+uint64_t ReadAssetBE(Stream& s)
+{
+    const uint64_t high{ser_readdata32be(s)};
+    return (high << 32) | ser_readdata32be(s);
+}
+
+/** (script, asset) with the asset written big endian so all assets of a script are adjacent and ordered */
+struct DBBalanceKey {
+    CScript script;
+    uint64_t asset;
+
+    DBBalanceKey() : asset(0) {}
+    DBBalanceKey(const CScript& script_in, uint64_t asset_in) : script(script_in), asset(asset_in) {}
+
+    template <typename Stream>
+    void Serialize(Stream& s) const
+    {
+        ser_writedata8(s, DB_BALANCE);
+        s << script;
+        WriteAssetBE(s, asset);
+    }
+
+    template <typename Stream>
+    void Unserialize(Stream& s)
+    {
+        const uint8_t prefix{ser_readdata8(s)};
+        if (prefix != DB_BALANCE) {
+            throw std::ios_base::failure("Invalid format for assetallocationindex DB balance key");
+        }
+        s >> script;
+        asset = ReadAssetBE(s);
+    }
+};
+
+/** (script, asset, height, position in block), iterates in chain order for a given script and asset */
+struct DBHistoryKey {
+    CScript script;
+    uint64_t asset;
+    int height;
+    uint32_t tx_pos;
+
+    DBHistoryKey() : asset(0), height(0), tx_pos(0) {}
+    DBHistoryKey(const CScript& script_in, uint64_t asset_in, int height_in, uint32_t tx_pos_in) : script(script_in), asset(asset_in), height(height_in), tx_pos(tx_pos_in) {}
+
+    template <typename Stream>
+    void Serialize(Stream& s) const
+    {
+        ser_writedata8(s, DB_HISTORY);
+        s << script;
+        WriteAssetBE(s, asset);
+        ser_writedata32be(s, height);
+        ser_writedata32be(s, tx_pos);
+    }
+
+    template <typename Stream>
+    void Unserialize(Stream& s)
+    {
+        const uint8_t prefix{ser_readdata8(s)};
+        if (prefix != DB_HISTORY) {
+            throw std::ios_base::failure("Invalid format for assetallocationindex DB history key");
+        }
+        s >> script;
+        asset = ReadAssetBE(s);
+        height = ser_readdata32be(s);
+        tx_pos = ser_readdata32be(s);
+    }
+};
+
+}; // namespace
+
+std::unique_ptr<AssetAllocationIndex> g_asset_allocation_index;
+
+AssetAllocationIndex::AssetAllocationIndex(std::unique_ptr<interfaces::Chain> chain, size_t n_cache_size, bool f_memory, bool f_wipe)
+    : AssetIndexBase(std::move(chain), "assetallocationindex", "assetallocation", n_cache_size, f_memory, f_wipe)
+{
+}
+
+bool AssetAllocationIndex::ApplyBlock(const CBlock& block, const CBlockUndo& block_undo, int height, const uint256& hash, bool fUndo)
+{
+    CDBBatch batch(*m_db);
+    std::map<std::pair<CScript, uint64_t>, CAmount> mapBlockDelta;
+    for (size_t i = 0; i < block.vtx.size(); ++i) {
+        const CTransaction& tx{*block.vtx[i]};
+        std::map<std::pair<CScript, uint64_t>, CAmount> mapTxDelta;
+        for (const CTxOut& out : tx.vout) {
+            // burns to NEVM leave the allocation set through an unspendable output
+            if (out.assetInfo.IsNull() || out.scriptPubKey.IsUnspendable()) {
+                continue;
+            }
+            mapTxDelta[{out.scriptPubKey, out.assetInfo.nAsset}] += out.assetInfo.nValue;
+        }
+        // The coinbase tx has no undo data since no former output is spent
+        if (!tx.IsCoinBase()) {
+            for (const Coin& coin : block_undo.vtxundo.at(i - 1).vprevout) {
+                if (coin.out.assetInfo.IsNull()) {
+                    continue;
+                }
+                mapTxDelta[{coin.out.scriptPubKey, coin.out.assetInfo.nAsset}] -= coin.out.assetInfo.nValue;
+            }
+        }
+        for (const auto& [key, nDelta] : mapTxDelta) {
+            if (nDelta == 0) {
+                continue;
+            }
+            const DBHistoryKey historyKey{key.first, key.second, height, static_cast<uint32_t>(i)};
+            if (fUndo) {
+                batch.Erase(historyKey);
+            } else {
+                batch.Write(historyKey, std::make_pair(tx.GetHash(), nDelta));
+            }
+            mapBlockDelta[key] += nDelta;
+        }
+    }
+    for (const auto& [key, nDelta] : mapBlockDelta) {
+        if (nDelta == 0) {
+            continue;
+        }
+        const DBBalanceKey balanceKey{key.first, key.second};
+        CAmount nBalance{0};
+        if (!m_db->Read(balanceKey, nBalance) && m_db->Exists(balanceKey)) {
+            return error("%s: Cannot read balance of asset %llu; %s may be corrupted", __func__, key.second, GetName());
+        }
+        nBalance += fUndo ? -nDelta : nDelta;
+        if (nBalance == 0) {
+            batch.Erase(balanceKey);
+        } else {
+            batch.Write(balanceKey, nBalance);
+        }
+    }
+    WriteBlockMarker(batch, height, hash, fUndo);
+    return m_db->WriteBatch(batch);
+}
+
+bool AssetAllocationIndex::FindBalance(const CScript& script, uint64_t nAsset, CAmount& nBalance) const
+{
+    return m_db->Read(DBBalanceKey{script, nAsset}, nBalance);
+}
+
+std::vector<std::pair<uint64_t, CAmount>> AssetAllocationIndex::FindBalances(const CScript& script) const
+{
+    std::vector<std::pair<uint64_t, CAmount>> vecBalances;
+    std::unique_ptr<CDBIterator> db_it(m_db->NewIterator());
+    DBBalanceKey key{script, 0};
+    for (db_it->Seek(key); db_it->Valid() && db_it->GetKey(key) && key.script == script; db_it->Next()) {
+        CAmount nBalance{0};
+        if (db_it->GetValue(nBalance)) {
+            vecBalances.emplace_back(key.asset, nBalance);
+        }
+    }
+    return vecBalances;
+}
+
+std::vector<AssetAllocationDelta> AssetAllocationIndex::FindHistory(const CScript& script, uint64_t nAsset, int nFromHeight, size_t count) const
+{
+    std::vector<AssetAllocationDelta> vecHistory;
+    std::unique_ptr<CDBIterator> db_it(m_db->NewIterator());
+    DBHistoryKey key{script, nAsset, std::max(nFromHeight, 0), 0};
+    for (db_it->Seek(key); vecHistory.size() < count && db_it->Valid() && db_it->GetKey(key) && key.script == script && key.asset == nAsset; db_it->Next()) {
+        std::pair<uint256, CAmount> value;
+        if (db_it->GetValue(value)) {
+            vecHistory.push_back({key.height, value.first, value.second});
+        }
+    }
+    return vecHistory;
+}
@@ -0,0 +1,57 @@
+// Copyright (c) 2024 The Syscoin Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef SYSCOIN_INDEX_ASSETALLOCATIONINDEX_H
+#define SYSCOIN_INDEX_ASSETALLOCATIONINDEX_H
+
+#include <consensus/amount.h>
+#include <index/assetindexbase.h>
+#include <script/script.h>
+
+#include <vector>
+
+class CBlock;
+class CBlockUndo;
+
+static constexpr bool DEFAULT_ASSETALLOCATIONINDEX{false};
+/** Upper bound on history entries returned by a single lookup */
+static constexpr size_t MAX_ASSETALLOCATION_HISTORY{1000};
+
+/** One change to the balance of an asset held by a script */
+struct AssetAllocationDelta {
+    int height{0};
+    uint256 txid;
+    CAmount amount{0};
+};
+
+/**
+ * AssetAllocationIndex tracks the asset balances held by every script and the
+ * history of changes to them. Balances are keyed by (scriptPubKey, asset guid)
+ * and history entries by (scriptPubKey, asset guid, height, position in block),
+ * so both are a single LevelDB seek away. Spent allocations are taken from the
+ * block undo data.
+ */
+class AssetAllocationIndex final : public AssetIndexBase
+{
+protected:
+    [[nodiscard]] bool ApplyBlock(const CBlock& block, const CBlockUndo& block_undo, int height, const uint256& hash, bool fUndo) override;
+
+public:
+    // Constructs the index, which becomes available to be queried.
+    explicit AssetAllocationIndex(std::unique_ptr<interfaces::Chain> chain, size_t n_cache_size, bool f_memory = false, bool f_wipe = false);
+
+    /** Balance of a single asset held by script, false if the script never held it */
+    bool FindBalance(const CScript& script, uint64_t nAsset, CAmount& nBalance) const;
+
+    /** Every non-zero asset balance held by script, ordered by asset guid */
+    std::vector<std::pair<uint64_t, CAmount>> FindBalances(const CScript& script) const;
+
+    /** Up to count balance changes of an asset held by script, oldest first, starting at nFromHeight */
+    std::vector<AssetAllocationDelta> FindHistory(const CScript& script, uint64_t nAsset, int nFromHeight, size_t count) const;
+};
+
+/// The global asset allocation index. May be null.
+extern std::unique_ptr<AssetAllocationIndex> g_asset_allocation_index;
+
+#endif // SYSCOIN_INDEX_ASSETALLOCATIONINDEX_H
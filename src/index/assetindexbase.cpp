@@ -0,0 +1,137 @@
+// Copyright (c) 2024 The Syscoin Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <index/assetindexbase.h>
+
+#include <common/args.h>
+#include <logging.h>
+#include <node/blockstorage.h>
+#include <serialize.h>
+#include <undo.h>
+#include <validation.h>
+
+static constexpr uint8_t DB_BLOCK_HEIGHT{'k'};
+
+namespace {
+
+/** Marks a block whose changes are in the database, written in the same batch as those changes */
+struct DBHeightKey {
+    int height;
+
+    explicit DBHeightKey(int height_in) : height(height_in) {}
+
+    template <typename Stream>
+    void Serialize(Stream& s) const
+    {
+        ser_writedata8(s, DB_BLOCK_HEIGHT);
+        ser_writedata32be(s, height);
+    }
+
+    template <typename Stream>
+    void Unserialize(Stream& s)
+    {
+        const uint8_t prefix{ser_readdata8(s)};
+        if (prefix != DB_BLOCK_HEIGHT) {
+            throw std::ios_base::failure("Invalid format for asset index DB height key");
+        }
+        height = ser_readdata32be(s);
+    }
+};
+
+}; // namespace
+
+AssetIndexBase::AssetIndexBase(std::unique_ptr<interfaces::Chain> chain, std::string name, const std::string& dir_name, size_t n_cache_size, bool f_memory, bool f_wipe)
+    : BaseIndex(std::move(chain), std::move(name))
+{
+    fs::path path{gArgs.GetDataDirNet() / "indexes" / fs::u8path(dir_name)};
+    fs::create_directories(path);
+
+    m_db = std::make_unique<BaseIndex::DB>(path / "db", n_cache_size, f_memory, f_wipe);
+}
+
+void AssetIndexBase::WriteBlockMarker(CDBBatch& batch, int height, const uint256& hash, bool fUndo)
+{
+    if (fUndo) {
+        batch.Erase(DBHeightKey(height));
+    } else {
+        batch.Write(DBHeightKey(height), hash);
+    }
+}
+
+bool AssetIndexBase::CustomInit(const std::optional<interfaces::BlockKey>& block)
+{
+    // Blocks appended after the last committed best block survive an unclean shutdown, take them out
+    // again so the sync that follows does not count them twice.
+    const int nStartHeight{block ? block->height + 1 : 1};
+    std::vector<std::pair<int, uint256>> vecApplied;
+    {
+        std::unique_ptr<CDBIterator> db_it(m_db->NewIterator());
+        DBHeightKey key{nStartHeight};
+        for (db_it->Seek(key); db_it->Valid() && db_it->GetKey(key); db_it->Next()) {
+            uint256 hash;
+            if (!db_it->GetValue(hash)) {
+                return error("%s: Cannot read block at height %d; %s may be corrupted", __func__, key.height, GetName());
+            }
+            vecApplied.emplace_back(key.height, hash);
+        }
+    }
+    for (auto it = vecApplied.rbegin(); it != vecApplied.rend(); ++it) {
+        const auto& [nHeight, hash] = *it;
+        const CBlockIndex* pindex{WITH_LOCK(cs_main, return m_chainstate->m_blockman.LookupBlockIndex(hash))};
+        CBlock blockApplied;
+        CBlockUndo block_undo;
+        if (!pindex || !m_chainstate->m_blockman.ReadBlockFromDisk(blockApplied, *pindex, false) ||
+            !m_chainstate->m_blockman.UndoReadFromDisk(block_undo, *pindex)) {
+            return error("%s: Cannot read block %s to roll back %s", __func__, hash.ToString(), GetName());
+        }
+        if (!ApplyBlock(blockApplied, block_undo, nHeight, hash, true)) {
+            return false;
+        }
+        LogPrint(BCLog::SYS, "%s: rolled back uncommitted block %s at height %d\n", __func__, hash.ToString(), nHeight);
+    }
+    return true;
+}
+
+bool AssetIndexBase::CustomAppend(const interfaces::BlockInfo& block)
+{
+    // Ignore genesis block
+    if (block.height == 0) return true;
+
+    assert(block.data);
+    // pindex variable gives indexing code access to node internals. It
+    // will be removed in upcoming commit
+    const CBlockIndex* pindex = WITH_LOCK(cs_main, return m_chainstate->m_blockman.LookupBlockIndex(block.hash));
+    CBlockUndo block_undo;
+    if (!m_chainstate->m_blockman.UndoReadFromDisk(block_undo, *pindex)) {
+        return false;
+    }
+    return ApplyBlock(*block.data, block_undo, block.height, block.hash, false);
+}
+
+bool AssetIndexBase::CustomRewind(const interfaces::BlockKey& current_tip, const interfaces::BlockKey& new_tip)
+{
+    LOCK(cs_main);
+    const CBlockIndex* iter_tip{m_chainstate->m_blockman.LookupBlockIndex(current_tip.hash)};
+    const CBlockIndex* new_tip_index{m_chainstate->m_blockman.LookupBlockIndex(new_tip.hash)};
+
+    do {
+        CBlock block;
+        CBlockUndo block_undo;
+        if (!m_chainstate->m_blockman.ReadBlockFromDisk(block, *iter_tip, false)) {
+            return error("%s: Failed to read block %s from disk",
+                         __func__, iter_tip->GetBlockHash().ToString());
+        }
+        if (!m_chainstate->m_blockman.UndoReadFromDisk(block_undo, *iter_tip)) {
+            return error("%s: Failed to read undo data of block %s from disk",
+                         __func__, iter_tip->GetBlockHash().ToString());
+        }
+        if (!ApplyBlock(block, block_undo, iter_tip->nHeight, iter_tip->GetBlockHash(), true)) {
+            return false;
+        }
+
+        iter_tip = iter_tip->GetAncestor(iter_tip->nHeight - 1);
+    } while (new_tip_index != iter_tip);
+
+    return true;
+}
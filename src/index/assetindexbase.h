@@ -0,0 +1,47 @@
+// Copyright (c) 2024 The Syscoin Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef SYSCOIN_INDEX_ASSETINDEXBASE_H
+#define SYSCOIN_INDEX_ASSETINDEXBASE_H
+
+#include <index/base.h>
+
+#include <memory>
+#include <string>
+
+class CBlock;
+class CBlockUndo;
+class CDBBatch;
+
+/**
+ * Base of the asset indexes, which apply each block together with its undo data and reverse it on a
+ * rewind. Every batch that applies a block also marks its height, so blocks appended after the last
+ * committed best block can be found and rolled back when the index starts after an unclean shutdown.
+ */
+class AssetIndexBase : public BaseIndex
+{
+protected:
+    std::unique_ptr<BaseIndex::DB> m_db;
+
+    /** Opens the database in indexes/<dir_name> of the data directory */
+    AssetIndexBase(std::unique_ptr<interfaces::Chain> chain, std::string name, const std::string& dir_name, size_t n_cache_size, bool f_memory, bool f_wipe);
+
+    /** Write the changes of a block to the database, or reverse them when fUndo is set */
+    [[nodiscard]] virtual bool ApplyBlock(const CBlock& block, const CBlockUndo& block_undo, int height, const uint256& hash, bool fUndo) = 0;
+
+    /** Mark the block at height as applied, or clear the mark when fUndo is set, in the batch that applies it */
+    static void WriteBlockMarker(CDBBatch& batch, int height, const uint256& hash, bool fUndo);
+
+    bool AllowPrune() const override { return true; }
+
+    bool CustomInit(const std::optional<interfaces::BlockKey>& block) override;
+
+    bool CustomAppend(const interfaces::BlockInfo& block) override;
+
+    bool CustomRewind(const interfaces::BlockKey& current_tip, const interfaces::BlockKey& new_tip) override;
+
+    BaseIndex::DB& GetDB() const override { return *m_db; }
+};
+
+#endif // SYSCOIN_INDEX_ASSETINDEXBASE_H
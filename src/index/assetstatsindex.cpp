@@ -0,0 +1,188 @@
+// Copyright (c) 2024 The Syscoin Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <index/assetstatsindex.h>
+
+#include <logging.h>
+#include <node/blockstorage.h>
+#include <serialize.h>
+#include <undo.h>
+#include <validation.h>
+
+#include <map>
+
+static constexpr uint8_t DB_BALANCE{'b'};
+static constexpr uint8_t DB_STATS{'s'};
+
+namespace {
+
+template <typename Stream>
+void WriteAssetBE(Stream& s, uint64_t asset)
+{
+    ser_writedata32be(s, static_cast<uint32_t>(asset >> 32));
+    ser_writedata32be(s, static_cast<uint32_t>(asset));
+}
+
+template <typename Stream>
+uint64_t ReadAssetBE(Stream& s)
+{
+    const uint64_t high{ser_readdata32be(s)};
+    return (high << 32) | ser_readdata32be(s);
+}
+
+/** Balance of an asset held by a script, needed to tell when a script starts or stops being a holder */
+struct DBBalanceKey {
+    uint64_t asset;
+    CScript script;
+
+    DBBalanceKey(uint64_t asset_in, const CScript& script_in) : asset(asset_in), script(script_in) {}
+
+    template <typename Stream>
+    void Serialize(Stream& s) const
+    {
+        ser_writedata8(s, DB_BALANCE);
+        WriteAssetBE(s, asset);
+        s << script;
+    }
+};
+
+/** (asset, inverted height) so that seeking to a height lands on the newest snapshot at or below it */
+struct DBStatsKey {
+    uint64_t asset;
+    int height;
+
+    DBStatsKey(uint64_t asset_in, int height_in) : asset(asset_in), height(height_in) {}
+
+    template <typename Stream>
+    void Serialize(Stream& s) const
+    {
+        ser_writedata8(s, DB_STATS);
+        WriteAssetBE(s, asset);
+        ser_writedata32be(s, ~static_cast<uint32_t>(height));
+    }
+
+    template <typename Stream>
+    void Unserialize(Stream& s)
+    {
+        const uint8_t prefix{ser_readdata8(s)};
+        if (prefix != DB_STATS) {
+            throw std::ios_base::failure("Invalid format for assetstatsindex DB stats key");
+        }
+        asset = ReadAssetBE(s);
+        height = static_cast<int>(~ser_readdata32be(s));
+    }
+};
+
+/** Change of the totals of an asset within one block */
+struct StatsDelta {
+    CAmount supply{0};
+    CAmount minted{0};
+    CAmount burned{0};
+    int64_t holders{0};
+};
+
+}; // namespace
+
+std::unique_ptr<AssetStatsIndex> g_asset_stats_index;
+
+AssetStatsIndex::AssetStatsIndex(std::unique_ptr<interfaces::Chain> chain, size_t n_cache_size, bool f_memory, bool f_wipe)
+    : AssetIndexBase(std::move(chain), "assetstatsindex", "assetstats", n_cache_size, f_memory, f_wipe)
+{
+}
+
+bool AssetStatsIndex::ApplyBlock(const CBlock& block, const CBlockUndo& block_undo, int height, const uint256& hash, bool fUndo)
+{
+    std::map<uint64_t, StatsDelta> mapStatsDelta;
+    std::map<std::pair<uint64_t, CScript>, CAmount> mapBalanceDelta;
+    for (size_t i = 0; i < block.vtx.size(); ++i) {
+        const CTransaction& tx{*block.vtx[i]};
+        CAssetsMap mapIn, mapOut;
+        for (const CTxOut& out : tx.vout) {
+            if (out.assetInfo.IsNull()) {
+                continue;
+            }
+            mapOut[out.assetInfo.nAsset] += out.assetInfo.nValue;
+            if (out.scriptPubKey.IsUnspendable()) {
+                mapStatsDelta[out.assetInfo.nAsset].burned += out.assetInfo.nValue;
+            } else {
+                mapStatsDelta[out.assetInfo.nAsset].supply += out.assetInfo.nValue;
+                mapBalanceDelta[{out.assetInfo.nAsset, out.scriptPubKey}] += out.assetInfo.nValue;
+            }
+        }
+        // The coinbase tx has no undo data since no former output is spent
+        if (!tx.IsCoinBase()) {
+            for (const Coin& coin : block_undo.vtxundo.at(i - 1).vprevout) {
+                if (coin.out.assetInfo.IsNull()) {
+                    continue;
+                }
+                mapIn[coin.out.assetInfo.nAsset] += coin.out.assetInfo.nValue;
+                mapStatsDelta[coin.out.assetInfo.nAsset].supply -= coin.out.assetInfo.nValue;
+                mapBalanceDelta[{coin.out.assetInfo.nAsset, coin.out.scriptPubKey}] -= coin.out.assetInfo.nValue;
+            }
+        }
+        // whatever leaves a transaction beyond what came in was created, mints and SYS to SYSX burns
+        for (const auto& [nAsset, nValueOut] : mapOut) {
+            const auto itIn = mapIn.find(nAsset);
+            const CAmount nValueIn{itIn != mapIn.end() ? itIn->second : 0};
+            if (nValueOut > nValueIn) {
+                mapStatsDelta[nAsset].minted += nValueOut - nValueIn;
+            }
+        }
+    }
+    CDBBatch batch(*m_db);
+    for (const auto& [key, nDelta] : mapBalanceDelta) {
+        if (nDelta == 0) {
+            continue;
+        }
+        const DBBalanceKey balanceKey{key.first, key.second};
+        CAmount nBalance{0};
+        if (!m_db->Read(balanceKey, nBalance) && m_db->Exists(balanceKey)) {
+            return error("%s: Cannot read a balance of asset %llu; %s may be corrupted", __func__, key.first, GetName());
+        }
+        const CAmount nNewBalance{nBalance + (fUndo ? -nDelta : nDelta)};
+        if (nNewBalance == 0) {
+            batch.Erase(balanceKey);
+        } else {
+            batch.Write(balanceKey, nNewBalance);
+        }
+        // holder changes only matter going forward, rewinding drops the snapshot that counted them
+        if (!fUndo) {
+            if (nBalance == 0 && nNewBalance != 0) {
+                ++mapStatsDelta[key.first].holders;
+            } else if (nBalance != 0 && nNewBalance == 0) {
+                --mapStatsDelta[key.first].holders;
+            }
+        }
+    }
+    for (const auto& [nAsset, delta] : mapStatsDelta) {
+        if (fUndo) {
+            batch.Erase(DBStatsKey(nAsset, height));
+            continue;
+        }
+        AssetStats stats{LookUpStats(nAsset, height - 1).value_or(AssetStats{})};
+        stats.height = height;
+        stats.supply += delta.supply;
+        stats.minted += delta.minted;
+        stats.burned += delta.burned;
+        stats.holders += delta.holders;
+        batch.Write(DBStatsKey(nAsset, height), stats);
+    }
+    WriteBlockMarker(batch, height, hash, fUndo);
+    return m_db->WriteBatch(batch);
+}
+
+std::optional<AssetStats> AssetStatsIndex::LookUpStats(uint64_t nAsset, int height) const
+{
+    if (height < 0) {
+        return std::nullopt;
+    }
+    std::unique_ptr<CDBIterator> db_it(m_db->NewIterator());
+    DBStatsKey key{nAsset, height};
+    db_it->Seek(key);
+    AssetStats stats;
+    if (!db_it->Valid() || !db_it->GetKey(key) || key.asset != nAsset || !db_it->GetValue(stats)) {
+        return std::nullopt;
+    }
+    return stats;
+}
@@ -0,0 +1,60 @@
+// Copyright (c) 2024 The Syscoin Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef SYSCOIN_INDEX_ASSETSTATSINDEX_H
+#define SYSCOIN_INDEX_ASSETSTATSINDEX_H
+
+#include <consensus/amount.h>
+#include <index/assetindexbase.h>
+#include <serialize.h>
+
+#include <optional>
+
+class CBlock;
+class CBlockUndo;
+
+static constexpr bool DEFAULT_ASSETSTATSINDEX{false};
+
+/** Running totals of an asset as of a block height */
+struct AssetStats {
+    //! Height of the last block that changed the totals, at or below the height asked for
+    int height{0};
+    //! Allocations held in spendable outputs
+    CAmount supply{0};
+    //! Allocations created by mints and SYS to SYSX burns
+    CAmount minted{0};
+    //! Allocations moved to unspendable outputs by burns to NEVM or SYS
+    CAmount burned{0};
+    //! Scripts holding a non-zero balance
+    uint64_t holders{0};
+
+    SERIALIZE_METHODS(AssetStats, obj)
+    {
+        READWRITE(obj.height, obj.supply, obj.minted, obj.burned, obj.holders);
+    }
+};
+
+/**
+ * AssetStatsIndex maintains the supply, mint and burn totals and holder count
+ * of every asset. A snapshot is written for each asset at each height where it
+ * changes, keyed so that a single seek finds the snapshot in effect at any
+ * height of the active chain.
+ */
+class AssetStatsIndex final : public AssetIndexBase
+{
+protected:
+    [[nodiscard]] bool ApplyBlock(const CBlock& block, const CBlockUndo& block_undo, int height, const uint256& hash, bool fUndo) override;
+
+public:
+    // Constructs the index, which becomes available to be queried.
+    explicit AssetStatsIndex(std::unique_ptr<interfaces::Chain> chain, size_t n_cache_size, bool f_memory = false, bool f_wipe = false);
+
+    // Look up the totals of an asset as of a height of the active chain, nullopt if the asset did not exist yet
+    std::optional<AssetStats> LookUpStats(uint64_t nAsset, int height) const;
+};
+
+/// The global asset stats index. May be null.
+extern std::unique_ptr<AssetStatsIndex> g_asset_stats_index;
+
+#endif // SYSCOIN_INDEX_ASSETSTATSINDEX_H
@@ -28,6 +28,8 @@
 #include <httprpc.h>
 #include <httpserver.h>
 #include <index/blockfilterindex.h>
+#include <index/assetallocationindex.h>
+#include <index/assetstatsindex.h>
 #include <index/coinstatsindex.h>
 #include <index/txindex.h>
 #include <init/common.h>
@@ -303,6 +305,13 @@ void Interrupt(NodeContext& node)
     if (g_coin_stats_index) {
         g_coin_stats_index->Interrupt();
     }
+    // SYSCOIN
+    if (g_asset_allocation_index) {
+        g_asset_allocation_index->Interrupt();
+    }
+    if (g_asset_stats_index) {
+        g_asset_stats_index->Interrupt();
+    }
 }
 
 void Shutdown(NodeContext& node)
@@ -399,6 +408,15 @@ void Shutdown(NodeContext& node)
             g_coin_stats_index->Stop();
             g_coin_stats_index.reset();
         }
+        // SYSCOIN
+        if (g_asset_allocation_index) {
+            g_asset_allocation_index->Stop();
+            g_asset_allocation_index.reset();
+        }
+        if (g_asset_stats_index) {
+            g_asset_stats_index->Stop();
+            g_asset_stats_index.reset();
+        }
         ForEachBlockFilterIndex([](BlockFilterIndex& index) { index.Stop(); });
         DestroyAllBlockFilterIndexes();
     }
@@ -575,6 +593,8 @@ void SetupServerArgs(ArgsManager& argsman)
 #endif
     argsman.AddArg("-blockreconstructionextratxn=<n>", strprintf("Extra transactions to keep in memory for compact block reconstructions (default: %u)", DEFAULT_BLOCK_RECONSTRUCTION_EXTRA_TXN), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-blocksonly", strprintf("Whether to reject transactions from network peers. Automatic broadcast and rebroadcast of any transactions from inbound peers is disabled, unless the peer has the 'forcerelay' permission. RPC transactions are not affected. (default: %u)", DEFAULT_BLOCKSONLY), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-assetallocationindex", strprintf("Maintain an index of asset balances and balance history per address, used by the assetallocationbalances and assetallocationhistory RPCs (default: %u)", DEFAULT_ASSETALLOCATIONINDEX), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-assetstatsindex", strprintf("Maintain per-asset supply, mint and burn totals and holder counts, used by the getassetstats RPC (default: %u)", DEFAULT_ASSETSTATSINDEX), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-coinstatsindex", strprintf("Maintain coinstats index used by the gettxoutsetinfo RPC (default: %u)", DEFAULT_COINSTATSINDEX), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-conf=<file>", strprintf("Specify path to read-only configuration file. Relative paths will be prefixed by datadir location (only useable from command line, not configuration file) (default: %s)", SYSCOIN_CONF_FILENAME), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-datadir=<dir>", "Specify data directory", ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
@@ -584,6 +604,8 @@ void SetupServerArgs(ArgsManager& argsman)
     argsman.AddArg("-allowignoredconf", strprintf("For backwards compatibility, treat an unused %s file in the datadir as a warning, not an error.", SYSCOIN_CONF_FILENAME), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-loadblock=<file>", "Imports blocks from external file on startup", ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-maxmempool=<n>", strprintf("Keep the transaction memory pool below <n> megabytes (default: %u)", DEFAULT_MAX_MEMPOOL_SIZE_MB), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    // SYSCOIN
+    argsman.AddArg("-maxmempoolblobs=<n>", strprintf("Keep the PoDA blob data of transactions in the memory pool below <n> megabytes, evicting the lowest fee per blob byte first (default: %u)", DEFAULT_MAX_MEMPOOL_BLOBS_MB), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-maxorphantx=<n>", strprintf("Keep at most <n> unconnectable transactions in memory (default: %u)", DEFAULT_MAX_ORPHAN_TRANSACTIONS), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-mempoolexpiry=<n>", strprintf("Do not keep transactions in the mempool longer than <n> hours (default: %u)", DEFAULT_MEMPOOL_EXPIRY_HOURS), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-minimumchainwork=<hex>", strprintf("Minimum work assumed to exist on a valid chain in hex (default: %s, testnet: %s, signet: %s)", defaultChainParams->GetConsensus().nMinimumChainWork.GetHex(), testnetChainParams->GetConsensus().nMinimumChainWork.GetHex(), signetChainParams->GetConsensus().nMinimumChainWork.GetHex()), ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::OPTIONS);
@@ -606,6 +628,8 @@ void SetupServerArgs(ArgsManager& argsman)
     // SYSCOIN
     argsman.AddArg("-gethcommandline=<port>", strprintf("Geth command line parameters (default: %s)", ""), ArgsManager::ALLOW_ANY, OptionsCategory::RPC);
     argsman.AddArg("-gethstartuptimeout=<n>", strprintf("Maximum seconds to wait for sysgeth to become ready during startup before NEVM is marked offline (0 = wait indefinitely, default: %d)", DEFAULT_GETH_STARTUP_TIMEOUT), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-nevmconnectwindow=<n>", strprintf("Number of NEVM block connects kept in flight while syncing or reindexing, acknowledgements are matched by block hash (1 = synchronous, max: %d, default: %d)", MAX_NEVM_CONNECT_WINDOW, DEFAULT_NEVM_CONNECT_WINDOW), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-nevmblobcache=<n>", strprintf("Memory kept for recently stored or served NEVM blobs in MiB, 0 disables the cache (default: %d)", DEFAULT_NEVM_BLOB_CACHE_MB), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-gethbootstrapstartuptimeout=<n>", strprintf("Maximum seconds to wait for sysgeth to become ready while state bootstrap is active (0 = wait indefinitely, default: %d)", DEFAULT_GETH_BOOTSTRAP_STARTUP_TIMEOUT), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-sporkaddr=<hex>", strprintf("Override spork address. Only useful for regtest. Using this on mainnet or testnet will ban you."), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-mnconf=<file>", strprintf("Specify masternode configuration file (default: %s)", "masternode.conf"), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
@@ -728,6 +752,8 @@ void SetupServerArgs(ArgsManager& argsman)
     argsman.AddArg("-zmqpubrawgovernancevote=<address>", "Enable publish raw governance votes transaction in <address>", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
     argsman.AddArg("-zmqpubrawgovernanceobject=<address>", "Enable publish raw governance objects transaction in <address>", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
     argsman.AddArg("-zmqpubrawmempooltx=<address>", "Enable publish raw transaction in <address> when entering mempool only", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
+    argsman.AddArg("-zmqpubzdagstatus=<address>", "Enable publish ZDAG status transitions of mempool transactions in <address>", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
+    argsman.AddArg("-zmqpubzdagstatushwm=<n>", strprintf("Set publish ZDAG status outbound message high water mark (default: %d)", CZMQAbstractNotifier::DEFAULT_ZMQ_SNDHWM), ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
     argsman.AddArg("-zmqpubrawmempooltxhwm=<n>", strprintf("Set publish raw mempool transaction outbound message high water mark (default: %d)", CZMQAbstractNotifier::DEFAULT_ZMQ_SNDHWM), ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
     argsman.AddArg("-zmqpubsequencehwm=<n>", strprintf("Set publish hash sequence message high water mark (default: %d)", CZMQAbstractNotifier::DEFAULT_ZMQ_SNDHWM), ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
 #else
@@ -742,6 +768,8 @@ void SetupServerArgs(ArgsManager& argsman)
     hidden_args.emplace_back("-zmqpubrawgovernanceobject=<address>");
     hidden_args.emplace_back("-zmqpubrawmempooltx=<address>");
     hidden_args.emplace_back("-zmqpubrawmempoolhwm=<n>");
+    hidden_args.emplace_back("-zmqpubzdagstatus=<address>");
+    hidden_args.emplace_back("-zmqpubzdagstatushwm=<n>");
     hidden_args.emplace_back("-zmqpubsequence=<n>");
     hidden_args.emplace_back("-zmqpubhashblockhwm=<n>");
     hidden_args.emplace_back("-zmqpubhashtxhwm=<n>");
@@ -1348,7 +1376,9 @@ bool AppInitMain(NodeContext& node, interfaces::BlockAndHeaderTipInfo* tip_info)
     ValidationCacheSizes validation_cache_sizes{};
     ApplyArgsManOptions(args, validation_cache_sizes);
     if (!InitSignatureCache(validation_cache_sizes.signature_cache_bytes)
-        || !InitScriptExecutionCache(validation_cache_sizes.script_execution_cache_bytes))
+        || !InitScriptExecutionCache(validation_cache_sizes.script_execution_cache_bytes)
+        // SYSCOIN
+        || !InitMintProofCache(validation_cache_sizes.mint_proof_cache_bytes))
     {
         return InitError(strprintf(_("Unable to allocate memory for -maxsigcachesize: '%s' MiB"), args.GetIntArg("-maxsigcachesize", DEFAULT_MAX_SIG_CACHE_BYTES >> 20)));
     }
@@ -1805,6 +1835,7 @@ bool AppInitMain(NodeContext& node, interfaces::BlockAndHeaderTipInfo* tip_info)
         // SYSCOIN
         node::ChainstateLoadOptions options;
         options.fReindexGeth = fReindexGeth;
+        options.nevm_blob_cache_bytes = std::max<int64_t>(args.GetIntArg("-nevmblobcache", DEFAULT_NEVM_BLOB_CACHE_MB), 0) << 20;
         options.connman = Assert(node.connman.get());
         options.banman = Assert(node.banman.get());
         options.peerman = Assert(node.peerman.get());
@@ -2098,6 +2129,15 @@ bool AppInitMain(NodeContext& node, interfaces::BlockAndHeaderTipInfo* tip_info)
         g_coin_stats_index = std::make_unique<CoinStatsIndex>(interfaces::MakeChain(node), /*cache_size=*/0, false, fReindex);
         node.indexes.emplace_back(g_coin_stats_index.get());
     }
+    // SYSCOIN
+    if (args.GetBoolArg("-assetallocationindex", DEFAULT_ASSETALLOCATIONINDEX)) {
+        g_asset_allocation_index = std::make_unique<AssetAllocationIndex>(interfaces::MakeChain(node), /*cache_size=*/0, false, fReindex);
+        node.indexes.emplace_back(g_asset_allocation_index.get());
+    }
+    if (args.GetBoolArg("-assetstatsindex", DEFAULT_ASSETSTATSINDEX)) {
+        g_asset_stats_index = std::make_unique<AssetStatsIndex>(interfaces::MakeChain(node), /*cache_size=*/0, false, fReindex);
+        node.indexes.emplace_back(g_asset_stats_index.get());
+    }
 
     // Init indexes
     for (auto index : node.indexes) if (!index->Init()) return false;
@@ -21,6 +21,10 @@ class CChainParams;
 
 static constexpr bool DEFAULT_CHECKPOINTS_ENABLED{true};
 static constexpr auto DEFAULT_MAX_TIP_AGE{24h};
+// SYSCOIN
+/** Default for -nevmconnectwindow, 1 keeps NEVM block connects synchronous */
+static constexpr int DEFAULT_NEVM_CONNECT_WINDOW{1};
+static constexpr int MAX_NEVM_CONNECT_WINDOW{1024};
 
 namespace kernel {
 
@@ -49,6 +53,8 @@ struct ChainstateManagerOpts {
     std::vector<std::string> geth_commandline{std::vector<std::string>()};
     fs::path datadir_base{};
     bool reindex{false};
+    //! Number of NEVM block connects allowed in flight during initial sync.
+    int nevm_connect_window{DEFAULT_NEVM_CONNECT_WINDOW};
 };
 
 } // namespace kernel
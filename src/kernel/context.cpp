@@ -4,6 +4,7 @@
 
 #include <kernel/context.h>
 
+#include <crypto/multihash.h>
 #include <crypto/sha256.h>
 #include <key.h>
 #include <logging.h>
@@ -26,6 +27,8 @@ Context::Context()
     ECC_Start();
     // SYSCOIN
     BLSInit();
+    std::string multihash_algo = MultiHashAutoDetect();
+    LogPrintf("Using the '%s' PoDA blob hash implementation\n", multihash_algo);
 }
 
 Context::~Context()
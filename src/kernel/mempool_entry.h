@@ -50,6 +50,17 @@ struct CompareIteratorByHash {
     }
 };
 
+// SYSCOIN
+/** Bytes of PoDA blob data carried by a transaction */
+inline uint32_t GetTransactionBlobSize(const CTransaction& tx)
+{
+    uint32_t nSize{0};
+    for (const auto& txout : tx.vout) {
+        nSize += txout.vchNEVMData.size();
+    }
+    return nSize;
+}
+
 /** \class CTxMemPoolEntry
  *
  * CTxMemPoolEntry stores data about the corresponding transaction, as well
@@ -77,6 +88,8 @@ private:
     const CAmount nFee;             //!< Cached to avoid expensive parent-transaction lookups
     const int32_t nTxWeight;         //!< ... and avoid recomputing tx weight (also used for GetTxSize())
     const size_t nUsageSize;        //!< ... and total memory usage
+    // SYSCOIN
+    const uint32_t nBlobSize;       //!< PoDA blob bytes carried by the tx, accounted apart from nUsageSize
     const int64_t nTime;            //!< Local time when entering the mempool
     const uint64_t entry_sequence;  //!< Sequence number used to determine whether this transaction is too recent for relay
     const unsigned int entryHeight; //!< Chain height when entering the mempool
@@ -109,6 +122,7 @@ public:
           nFee{fee},
           nTxWeight{GetTransactionWeight(*tx)},
           nUsageSize{RecursiveDynamicUsage(tx)},
+          nBlobSize{GetTransactionBlobSize(*tx)},
           nTime{time},
           entry_sequence{entry_sequence},
           entryHeight{entry_height},
@@ -136,6 +150,8 @@ public:
     int64_t GetSigOpCost() const { return sigOpCost; }
     CAmount GetModifiedFee() const { return m_modified_fee; }
     size_t DynamicMemoryUsage() const { return nUsageSize; }
+    // SYSCOIN
+    uint32_t GetBlobSize() const { return nBlobSize; }
     const LockPoints& GetLockPoints() const { return lockPoints; }
 
     // Adjusts the descendant state.
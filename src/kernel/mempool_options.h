@@ -19,6 +19,9 @@ class CBlockPolicyEstimator;
 static constexpr unsigned int DEFAULT_MAX_MEMPOOL_SIZE_MB{300};
 /** Default for -maxmempool when blocksonly is set */
 static constexpr unsigned int DEFAULT_BLOCKSONLY_MAX_MEMPOOL_SIZE_MB{5};
+// SYSCOIN
+/** Default for -maxmempoolblobs, maximum megabytes of PoDA blob data carried by mempool transactions */
+static constexpr unsigned int DEFAULT_MAX_MEMPOOL_BLOBS_MB{512};
 /** Default for -mempoolexpiry, expiration time for mempool transactions in hours */
 static constexpr unsigned int DEFAULT_MEMPOOL_EXPIRY_HOURS{336};
 /** Default for -mempoolfullrbf, if the transaction replaceability signaling is ignored */
@@ -40,6 +43,8 @@ struct MemPoolOptions {
     /* The ratio used to determine how often sanity checks will run.  */
     int check_ratio{0};
     int64_t max_size_bytes{DEFAULT_MAX_MEMPOOL_SIZE_MB * 1'000'000};
+    // SYSCOIN blob bytes are held apart from max_size_bytes, they are stored on disk and dwarf the transactions carrying them
+    int64_t max_blob_bytes{DEFAULT_MAX_MEMPOOL_BLOBS_MB * 1'000'000};
     std::chrono::seconds expiry{std::chrono::hours{DEFAULT_MEMPOOL_EXPIRY_HOURS}};
     CFeeRate incremental_relay_feerate{DEFAULT_INCREMENTAL_RELAY_FEE};
     /** A fee rate smaller than this is considered zero fee (for relaying, mining and transaction creation) */
@@ -10,10 +10,15 @@
 #include <cstddef>
 #include <limits>
 
+// SYSCOIN
+static constexpr size_t DEFAULT_MAX_MINT_PROOF_CACHE_BYTES{1 << 20};
+
 namespace kernel {
 struct ValidationCacheSizes {
     size_t signature_cache_bytes{DEFAULT_MAX_SIG_CACHE_BYTES / 2};
     size_t script_execution_cache_bytes{DEFAULT_MAX_SIG_CACHE_BYTES / 2};
+    // SYSCOIN
+    size_t mint_proof_cache_bytes{DEFAULT_MAX_MINT_PROOF_CACHE_BYTES};
 };
 }
 
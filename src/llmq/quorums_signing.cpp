@@ -10,6 +10,7 @@
 
 #include <masternode/activemasternode.h>
 #include <bls/bls_batchverifier.h>
+#include <bls/bls_worker.h>
 #include <chainparams.h>
 #include <cxxtimer.hpp>
 #include <init.h>
@@ -53,6 +54,15 @@ CRecoveredSigsDb::~CRecoveredSigsDb() = default;
 
 bool CRecoveredSigsDb::HasRecoveredSig(const uint256& id, const uint256& msgHash) const
 {
+    {
+        LOCK(cs_cache);
+        std::shared_ptr<const CRecoveredSig> recSig;
+        if (recSigByIdCache.get(id, recSig)) {
+            ++cacheStats.recSigById.nHits;
+            return recSig && recSig->getMsgHash() == msgHash;
+        }
+        ++cacheStats.recSigById.nMisses;
+    }
     auto k = std::make_tuple(std::string("rs_r"), id, msgHash);
     return db->Exists(k);
 }
@@ -64,8 +74,10 @@ bool CRecoveredSigsDb::HasRecoveredSigForId(const uint256& id) const
     {
         LOCK(cs_cache);
         if (hasSigForIdCache.get(cacheKey, ret)) {
+            ++cacheStats.hasSigForId.nHits;
             return ret;
         }
+        ++cacheStats.hasSigForId.nMisses;
     }
 
 
@@ -83,8 +95,10 @@ bool CRecoveredSigsDb::HasRecoveredSigForSession(const uint256& signHash) const
     {
         LOCK(cs_cache);
         if (hasSigForSessionCache.get(signHash, ret)) {
+            ++cacheStats.hasSigForSession.nHits;
             return ret;
         }
+        ++cacheStats.hasSigForSession.nMisses;
     }
 
     auto k = std::make_tuple(std::string("rs_s"), signHash);
@@ -101,8 +115,10 @@ bool CRecoveredSigsDb::HasRecoveredSigForHash(const uint256& hash) const
     {
         LOCK(cs_cache);
         if (hasSigForHashCache.get(hash, ret)) {
+            ++cacheStats.hasSigForHash.nHits;
             return ret;
         }
+        ++cacheStats.hasSigForHash.nMisses;
     }
 
     auto k = std::make_tuple(std::string("rs_h"), hash);
@@ -133,7 +149,29 @@ bool CRecoveredSigsDb::GetRecoveredSigByHash(const uint256& hash, CRecoveredSig&
 
 bool CRecoveredSigsDb::GetRecoveredSigById(const uint256& id, CRecoveredSig& ret) const
 {
-    return ReadRecoveredSig(id, ret);
+    {
+        LOCK(cs_cache);
+        std::shared_ptr<const CRecoveredSig> recSig;
+        if (recSigByIdCache.get(id, recSig)) {
+            ++cacheStats.recSigById.nHits;
+            if (!recSig) {
+                return false;
+            }
+            ret = *recSig;
+            return true;
+        }
+        ++cacheStats.recSigById.nMisses;
+    }
+
+    const bool fFound = ReadRecoveredSig(id, ret);
+
+    LOCK(cs_cache);
+    // writes and removals store their result, positive or negative, once it is on disk. If one raced this read
+    // its entry is newer than what was read here and stays
+    if (!recSigByIdCache.exists(id)) {
+        recSigByIdCache.insert(id, fFound ? std::make_shared<const CRecoveredSig>(ret) : nullptr);
+    }
+    return fFound;
 }
 
 void CRecoveredSigsDb::WriteRecoveredSig(const llmq::CRecoveredSig& recSig)
@@ -170,6 +208,7 @@ void CRecoveredSigsDb::WriteRecoveredSig(const llmq::CRecoveredSig& recSig)
         hasSigForIdCache.insert(recSig.getId(), true);
         hasSigForSessionCache.insert(signHash, true);
         hasSigForHashCache.insert(recSig.GetHash(), true);
+        recSigByIdCache.insert(recSig.getId(), std::make_shared<const CRecoveredSig>(recSig));
     }
 }
 
@@ -216,18 +255,21 @@ void CRecoveredSigsDb::TruncateRecoveredSig(const uint256& id)
     CDBBatch batch(*db);
     RemoveRecoveredSig(batch, id, false, false);
     db->WriteBatch(batch);
+    // only once the batch is written, so the negative entry replaces a sig cached by a lookup in between
+    WITH_LOCK(cs_cache, recSigByIdCache.insert(id, nullptr));
 }
 
-void CRecoveredSigsDb::CleanupOldRecoveredSigs(int64_t maxAge)
+bool CRecoveredSigsDb::CleanupOldRecoveredSigs(int64_t maxAge)
 {
     std::unique_ptr<CDBIterator> pcursor(db->NewIterator());
 
-    auto start = std::make_tuple(std::string("rs_t"), (uint32_t)0, uint256());
+    auto start = std::make_tuple(std::string("rs_t"), (uint32_t)htobe32_internal(nRecSigsCleanupTime), uint256());
     uint32_t endTime = (uint32_t)(GetTime<std::chrono::seconds>().count() - maxAge);
     pcursor->Seek(start);
 
     std::vector<uint256> toDelete;
     std::vector<decltype(start)> toDelete2;
+    bool fMore = false;
 
     while (pcursor->Valid()) {
         decltype(start) k;
@@ -238,6 +280,10 @@ void CRecoveredSigsDb::CleanupOldRecoveredSigs(int64_t maxAge)
         if (be32toh_internal(std::get<1>(k)) >= endTime) {
             break;
         }
+        if (toDelete.size() == MAX_CLEANUP_ENTRIES) {
+            fMore = true;
+            break;
+        }
 
         toDelete.emplace_back(std::get<2>(k));
         toDelete2.emplace_back(k);
@@ -247,17 +293,14 @@ void CRecoveredSigsDb::CleanupOldRecoveredSigs(int64_t maxAge)
     pcursor.reset();
 
     if (toDelete.empty()) {
-        return;
+        // restart from the beginning next time, entries stamped before the cursor (the clock went back) are not skipped for good
+        nRecSigsCleanupTime = 0;
+        return false;
     }
 
     CDBBatch batch(*db);
     for (const auto& e : toDelete) {
         RemoveRecoveredSig(batch, e, true, false);
-
-        if (batch.SizeEstimate() >= (1 << 24)) {
-            db->WriteBatch(batch);
-            batch.Clear();
-        }
     }
 
     for (const auto& e : toDelete2) {
@@ -265,20 +308,49 @@ void CRecoveredSigsDb::CleanupOldRecoveredSigs(int64_t maxAge)
     }
 
     db->WriteBatch(batch);
+    {
+        LOCK(cs_cache);
+        for (const auto& e : toDelete) {
+            recSigByIdCache.insert(e, nullptr);
+        }
+    }
+    // entries of the last second may be left when the limit was hit, so resume at that second
+    nRecSigsCleanupTime = be32toh_internal(std::get<1>(toDelete2.back()));
 
-    LogPrint(BCLog::LLMQ, "CRecoveredSigsDb::%d -- deleted %d entries\n", __func__, toDelete.size());
+    LogPrint(BCLog::LLMQ, "CRecoveredSigsDb::%d -- deleted %d entries, more=%d\n", __func__, toDelete.size(), fMore);
+    return fMore;
 }
 
 bool CRecoveredSigsDb::HasVotedOnId(const uint256& id) const
 {
-    auto k = std::make_tuple(std::string("rs_v"), id);
-    return db->Exists(k);
+    uint256 msgHash;
+    return GetVoteForId(id, msgHash);
 }
 
 bool CRecoveredSigsDb::GetVoteForId(const uint256& id, uint256& msgHashRet) const
 {
+    {
+        LOCK(cs_cache);
+        std::optional<uint256> vote;
+        if (voteForIdCache.get(id, vote)) {
+            ++cacheStats.voteForId.nHits;
+            if (!vote) {
+                return false;
+            }
+            msgHashRet = *vote;
+            return true;
+        }
+        ++cacheStats.voteForId.nMisses;
+    }
+
     auto k = std::make_tuple(std::string("rs_v"), id);
-    return db->Read(k, msgHashRet);
+    const bool fFound = db->Read(k, msgHashRet);
+
+    LOCK(cs_cache);
+    if (!voteForIdCache.exists(id)) {
+        voteForIdCache.insert(id, fFound ? std::make_optional(msgHashRet) : std::nullopt);
+    }
+    return fFound;
 }
 
 void CRecoveredSigsDb::WriteVoteForId(const uint256& id, const uint256& msgHash)
@@ -291,18 +363,23 @@ void CRecoveredSigsDb::WriteVoteForId(const uint256& id, const uint256& msgHash)
     batch.Write(k2, (uint8_t)1);
 
     db->WriteBatch(batch);
+
+    LOCK(cs_cache);
+    voteForIdCache.insert(id, msgHash);
 }
 
-void CRecoveredSigsDb::CleanupOldVotes(int64_t maxAge)
+bool CRecoveredSigsDb::CleanupOldVotes(int64_t maxAge)
 {
     std::unique_ptr<CDBIterator> pcursor(db->NewIterator());
 
-    auto start = std::make_tuple(std::string("rs_vt"), (uint32_t)0, uint256());
+    auto start = std::make_tuple(std::string("rs_vt"), (uint32_t)htobe32_internal(nVotesCleanupTime), uint256());
     uint32_t endTime = (uint32_t)(GetTime<std::chrono::seconds>().count() - maxAge);
     pcursor->Seek(start);
 
     CDBBatch batch(*db);
-    size_t cnt = 0;
+    std::vector<uint256> toErase;
+    uint32_t nLastTime = 0;
+    bool fMore = false;
     while (pcursor->Valid()) {
         decltype(start) k;
 
@@ -312,31 +389,52 @@ void CRecoveredSigsDb::CleanupOldVotes(int64_t maxAge)
         if (be32toh_internal(std::get<1>(k)) >= endTime) {
             break;
         }
+        if (toErase.size() == MAX_CLEANUP_ENTRIES) {
+            fMore = true;
+            break;
+        }
 
         const uint256& id = std::get<2>(k);
 
         batch.Erase(k);
         batch.Erase(std::make_tuple(std::string("rs_v"), id));
-
-        cnt++;
+        toErase.emplace_back(id);
+        nLastTime = be32toh_internal(std::get<1>(k));
 
         pcursor->Next();
     }
     pcursor.reset();
 
-    if (cnt == 0) {
-        return;
+    if (toErase.empty()) {
+        // start over next time, see CleanupOldRecoveredSigs
+        nVotesCleanupTime = 0;
+        return false;
     }
 
     db->WriteBatch(batch);
+    {
+        LOCK(cs_cache);
+        for (const auto& id : toErase) {
+            voteForIdCache.insert(id, std::nullopt);
+        }
+    }
+    nVotesCleanupTime = nLastTime;
+
+    LogPrint(BCLog::LLMQ, "CRecoveredSigsDb::%d -- deleted %d entries, more=%d\n", __func__, toErase.size(), fMore);
+    return fMore;
+}
 
-    LogPrint(BCLog::LLMQ, "CRecoveredSigsDb::%d -- deleted %d entries\n", __func__, cnt);
+CRecoveredSigsCacheStats CRecoveredSigsDb::GetCacheStats() const
+{
+    LOCK(cs_cache);
+    return cacheStats;
 }
 
 //////////////////
 
-CSigningManager::CSigningManager(bool fMemory, PeerManager& _peerman, ChainstateManager& _chainman, bool fWipe) :
+CSigningManager::CSigningManager(bool fMemory, CBLSWorker& _blsWorker, PeerManager& _peerman, ChainstateManager& _chainman, bool fWipe) :
     db(fMemory, fWipe),
+    blsWorker(_blsWorker),
     peerman(_peerman),
     chainman(_chainman)
 {
@@ -444,19 +542,19 @@ void CSigningManager::ProcessMessageRecoveredSig(CNode* pfrom, const std::shared
     pendingRecoveredSigs[pfrom->GetId()].emplace_back(recoveredSig);
 }
 
-void CSigningManager::CollectPendingRecoveredSigsToVerify(
+size_t CSigningManager::CollectPendingRecoveredSigsToVerify(
         size_t maxUniqueSessions,
         std::unordered_map<NodeId, std::list<std::shared_ptr<const CRecoveredSig>>>& retSigShares,
         std::unordered_map<uint256, CQuorumCPtr, StaticSaltedHasher>& retQuorums)
 {
+    std::unordered_set<std::pair<NodeId, uint256>, StaticSaltedHasher> uniqueSignHashes;
     {
         LOCK(cs_pending);
         if (pendingRecoveredSigs.empty()) {
-            return;
+            return 0;
         }
 
         // TODO: refactor it to remove duplicated code with `CSigSharesManager::CollectPendingSigSharesToVerify`
-        std::unordered_set<std::pair<NodeId, uint256>, StaticSaltedHasher> uniqueSignHashes;
         IterateNodesRandom(pendingRecoveredSigs, [&]() {
             return uniqueSignHashes.size() < maxUniqueSessions;
         }, [&](NodeId nodeId, std::list<std::shared_ptr<const CRecoveredSig>>& ns) {
@@ -475,7 +573,7 @@ void CSigningManager::CollectPendingRecoveredSigsToVerify(
         }, rnd);
 
         if (retSigShares.empty()) {
-            return;
+            return uniqueSignHashes.size();
         }
     }
 
@@ -508,6 +606,7 @@ void CSigningManager::CollectPendingRecoveredSigsToVerify(
             ++it;
         }
     }
+    return uniqueSignHashes.size();
 }
 
 void CSigningManager::ProcessPendingReconstructedRecoveredSigs()
@@ -527,39 +626,71 @@ bool CSigningManager::ProcessPendingRecoveredSigs()
 
     ProcessPendingReconstructedRecoveredSigs();
 
-    const size_t nMaxBatchSize{32};
-    CollectPendingRecoveredSigsToVerify(nMaxBatchSize, recSigsByNode, quorums);
+    const size_t nBatchSize{nVerifyBatchSize};
+    // counted before sigs of unknown or inactive quorums are dropped, the round was full if it hit the limit
+    const size_t nUniqueSessions{CollectPendingRecoveredSigsToVerify(nBatchSize, recSigsByNode, quorums)};
     if (recSigsByNode.empty()) {
         return false;
     }
 
     // It's ok to perform insecure batched verification here as we verify against the quorum public keys, which are not
     // craftable by individual entities, making the rogue public key attack impossible
-    CBLSBatchVerifier<NodeId, uint256> batchVerifier(false, false);
+    // All recovered sigs of a node go to the same verifier so that bad ones are attributed to their source. Verifiers
+    // are filled up to VERIFY_SHARD_SIZE sigs and run in parallel on the BLS worker pool
+    std::vector<CBLSBatchVerifier<NodeId, uint256>> batchVerifiers;
+    // reserved so verifiers are never moved, they hold iterators into their own maps
+    batchVerifiers.reserve(recSigsByNode.size());
+    std::set<NodeId> badSources;
 
     size_t verifyCount = 0;
+    size_t shardCount = 0;
     for (const auto& p : recSigsByNode) {
         NodeId nodeId = p.first;
         const auto& v = p.second;
 
+        if (batchVerifiers.empty() || shardCount >= VERIFY_SHARD_SIZE) {
+            batchVerifiers.emplace_back(false, false);
+            shardCount = 0;
+        }
+        auto& batchVerifier = batchVerifiers.back();
+
         for (const auto& recSig : v) {
             // we didn't verify the lazy signature until now
             if (!recSig->sig.Get().IsValid()) {
-                batchVerifier.badSources.emplace(nodeId);
+                badSources.emplace(nodeId);
                 break;
             }
 
             const auto& quorum = quorums.at(recSig->getQuorumHash());
             batchVerifier.PushMessage(nodeId, recSig->GetHash(), recSig->buildSignHash(), recSig->sig.Get(), quorum->qc->quorumPublicKey);
             verifyCount++;
+            shardCount++;
         }
     }
 
     cxxtimer::Timer verifyTimer(true);
-    batchVerifier.Verify();
+    if (batchVerifiers.size() == 1) {
+        batchVerifiers[0].Verify();
+    } else {
+        std::vector<std::future<void>> futures;
+        futures.reserve(batchVerifiers.size());
+        for (auto& batchVerifier : batchVerifiers) {
+            futures.emplace_back(blsWorker.AsyncVerifyBatch(batchVerifier));
+        }
+        for (auto& future : futures) {
+            future.get();
+        }
+    }
     verifyTimer.stop();
 
-    LogPrint(BCLog::LLMQ, "CSigningManager::%s -- verified recovered sig(s). count=%d, vt=%d, nodes=%d\n", __func__, verifyCount, verifyTimer.count(), recSigsByNode.size());
+    for (const auto& batchVerifier : batchVerifiers) {
+        badSources.insert(batchVerifier.badSources.begin(), batchVerifier.badSources.end());
+    }
+
+    nVerifyBatchSize = NextVerifyBatchSize(nBatchSize, nUniqueSessions, !badSources.empty());
+
+    LogPrint(BCLog::LLMQ, "CSigningManager::%s -- verified recovered sig(s). count=%d, vt=%d, nodes=%d, shards=%d, bad=%d, batchSize=%d\n", __func__,
+             verifyCount, verifyTimer.count(), recSigsByNode.size(), batchVerifiers.size(), badSources.size(), nVerifyBatchSize);
 
     std::unordered_set<uint256, StaticSaltedHasher> processed;
     for (const auto& p : recSigsByNode) {
@@ -567,7 +698,7 @@ bool CSigningManager::ProcessPendingRecoveredSigs()
         const auto& v = p.second;
         PeerRef peer = peerman.GetPeerRef(nodeId);
 
-        if (batchVerifier.badSources.count(nodeId)) {
+        if (badSources.count(nodeId)) {
             LogPrint(BCLog::LLMQ, "CSigningManager::%s -- invalid recSig from other node, banning peer=%d\n", __func__, nodeId);
             if(peer)
                 peerman.Misbehaving(*peer, 100, "invalid recSig from other node");
@@ -583,7 +714,19 @@ bool CSigningManager::ProcessPendingRecoveredSigs()
         }
     }
 
-    return recSigsByNode.size() >= nMaxBatchSize;
+    return nUniqueSessions >= nBatchSize;
+}
+
+size_t CSigningManager::NextVerifyBatchSize(size_t nBatchSize, size_t nUniqueSessions, bool fBad)
+{
+    // grow the batch while rounds are full and clean, fall back quickly when peers send bad sigs
+    if (fBad) {
+        return std::max(nBatchSize / 2, MIN_VERIFY_BATCH_SIZE);
+    }
+    if (nUniqueSessions >= nBatchSize) {
+        return std::min(nBatchSize * 2, MAX_VERIFY_BATCH_SIZE);
+    }
+    return nBatchSize;
 }
 
 // signature must be verified already
@@ -715,10 +858,13 @@ void CSigningManager::Cleanup()
 
     int64_t maxAge = gArgs.GetIntArg("-maxrecsigsage", DEFAULT_MAX_RECOVERED_SIGS_AGE);
 
-    db.CleanupOldRecoveredSigs(maxAge);
-    db.CleanupOldVotes(maxAge);
+    const bool fMoreRecSigs = db.CleanupOldRecoveredSigs(maxAge);
+    const bool fMoreVotes = db.CleanupOldVotes(maxAge);
 
-    lastCleanupTime = TicksSinceEpoch<std::chrono::milliseconds>(SystemClock::now());
+    // a backlog is removed a bounded chunk per worker iteration instead of waiting for the next interval
+    if (!fMoreRecSigs && !fMoreVotes) {
+        lastCleanupTime = TicksSinceEpoch<std::chrono::milliseconds>(SystemClock::now());
+    }
 }
 
 void CSigningManager::RegisterRecoveredSigsListener(CRecoveredSigsListener* l)
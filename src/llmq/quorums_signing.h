@@ -13,9 +13,12 @@
 #include <util/threadinterrupt.h>
 #include <unordered_lru_cache.h>
 
+#include <memory>
+#include <optional>
 #include <unordered_map>
 
 
+class CBLSWorker;
 class CDataStream;
 class CDBBatch;
 class CDBWrapper;
@@ -75,6 +78,18 @@ public:
                   CSigBase(_quorumHash, _id, _msgHash), sig(_sig) {UpdateHash();};
     CRecoveredSig(const uint256& _quorumHash, const uint256& _id, const uint256& _msgHash, const CBLSSignature& _sig) :
                   CSigBase(_quorumHash, _id, _msgHash) {const_cast<CBLSLazySignature&>(sig).Set(_sig, bls::bls_legacy_scheme.load()); UpdateHash();};
+    CRecoveredSig(const CRecoveredSig& other) = default;
+
+    // replaces the whole recovered sig, as deserializing into it does (used to hand out cached copies)
+    CRecoveredSig& operator=(const CRecoveredSig& other)
+    {
+        quorumHash = other.quorumHash;
+        id = other.id;
+        msgHash = other.msgHash;
+        const_cast<CBLSLazySignature&>(sig) = other.sig;
+        hash = other.hash;
+        return *this;
+    }
 
 private:
     // only in-memory
@@ -102,37 +117,66 @@ public:
     UniValue ToJson() const;
 };
 
+/** Hits and misses of the caches in front of CRecoveredSigsDb, see quorum_recsigcacheinfo */
+struct CRecoveredSigsCacheStats {
+    struct Counter {
+        uint64_t nHits{0};
+        uint64_t nMisses{0};
+    };
+    Counter recSigById;
+    Counter voteForId;
+    Counter hasSigForId;
+    Counter hasSigForSession;
+    Counter hasSigForHash;
+};
+
 class CRecoveredSigsDb
 {
 private:
+    // expired entries removed per cleanup call, so a backlog is worked off over several worker iterations
+    static constexpr size_t MAX_CLEANUP_ENTRIES{1000};
+
     std::unique_ptr<CDBWrapper> db{nullptr};
 
+    // time the previous cleanup stopped at, the next one seeks there instead of over the deleted keys before it.
+    // Reset to 0 by a cleanup that finds nothing to remove
+    uint32_t nRecSigsCleanupTime{0};
+    uint32_t nVotesCleanupTime{0};
+
     mutable Mutex cs_cache;
     mutable unordered_lru_cache<uint256, bool, StaticSaltedHasher, 30000> hasSigForIdCache GUARDED_BY(cs_cache);
     mutable unordered_lru_cache<uint256, bool, StaticSaltedHasher, 30000> hasSigForSessionCache GUARDED_BY(cs_cache);
     mutable unordered_lru_cache<uint256, bool, StaticSaltedHasher, 30000> hasSigForHashCache GUARDED_BY(cs_cache);
+    // recent recovered sigs and votes by id, nullptr / nullopt when the id is known to have none
+    mutable unordered_lru_cache<uint256, std::shared_ptr<const CRecoveredSig>, StaticSaltedHasher, 10000> recSigByIdCache GUARDED_BY(cs_cache);
+    mutable unordered_lru_cache<uint256, std::optional<uint256>, StaticSaltedHasher, 10000> voteForIdCache GUARDED_BY(cs_cache);
+    mutable CRecoveredSigsCacheStats cacheStats GUARDED_BY(cs_cache);
 
 public:
     explicit CRecoveredSigsDb(bool fMemory, bool fWipe);
     ~CRecoveredSigsDb();
 
-    bool HasRecoveredSig(const uint256& id, const uint256& msgHash) const;
+    bool HasRecoveredSig(const uint256& id, const uint256& msgHash) const EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
     bool HasRecoveredSigForId(const uint256& id) const EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
     bool HasRecoveredSigForSession(const uint256& signHash) const EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
     bool HasRecoveredSigForHash(const uint256& hash) const EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
     bool GetRecoveredSigByHash(const uint256& hash, CRecoveredSig& ret) const;
-    bool GetRecoveredSigById(const uint256& id, CRecoveredSig& ret) const;
+    bool GetRecoveredSigById(const uint256& id, CRecoveredSig& ret) const EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
     void WriteRecoveredSig(const CRecoveredSig& recSig) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
     void TruncateRecoveredSig(const uint256& id) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
 
-    void CleanupOldRecoveredSigs(int64_t maxAge) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
+    /** Remove up to MAX_CLEANUP_ENTRIES recovered sigs older than maxAge, true if more are left */
+    bool CleanupOldRecoveredSigs(int64_t maxAge) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
 
     // votes are removed when the recovered sig is written to the db
-    bool HasVotedOnId(const uint256& id) const;
-    bool GetVoteForId(const uint256& id, uint256& msgHashRet) const;
-    void WriteVoteForId( const uint256& id, const uint256& msgHash);
+    bool HasVotedOnId(const uint256& id) const EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
+    bool GetVoteForId(const uint256& id, uint256& msgHashRet) const EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
+    void WriteVoteForId( const uint256& id, const uint256& msgHash) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
 
-    void CleanupOldVotes(int64_t maxAge);
+    /** Remove up to MAX_CLEANUP_ENTRIES votes older than maxAge, true if more are left */
+    bool CleanupOldVotes(int64_t maxAge) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
+
+    CRecoveredSigsCacheStats GetCacheStats() const EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
 
 private:
     bool ReadRecoveredSig(const uint256& id, CRecoveredSig& ret) const;
@@ -150,8 +194,14 @@ public:
 class CSigningManager
 {
 private:
+    // Recovered sigs collected per verification round, grows while the rounds are full and valid, shrinks on bad sigs
+    static constexpr size_t MIN_VERIFY_BATCH_SIZE{32};
+    static constexpr size_t MAX_VERIFY_BATCH_SIZE{512};
+    // Recovered sigs per verifier handed to the BLS worker pool
+    static constexpr size_t VERIFY_SHARD_SIZE{64};
 
     CRecoveredSigsDb db;
+    CBLSWorker& blsWorker;
     PeerManager& peerman;
     ChainstateManager& chainman;
 
@@ -163,12 +213,14 @@ private:
     FastRandomContext rnd GUARDED_BY(cs_pending);
 
     int64_t lastCleanupTime{0};
+    // only accessed from the worker thread of CSigSharesManager
+    size_t nVerifyBatchSize{MIN_VERIFY_BATCH_SIZE};
 
     mutable Mutex cs_listeners;
     std::vector<CRecoveredSigsListener*> recoveredSigsListeners GUARDED_BY(cs_listeners);
 
 public:
-    CSigningManager(bool fMemory, PeerManager& _peerman, ChainstateManager& _chainman, bool fWipe);
+    CSigningManager(bool fMemory, CBLSWorker& _blsWorker, PeerManager& _peerman, ChainstateManager& _chainman, bool fWipe);
 
 
     bool AlreadyHave(const uint256& hash) const EXCLUSIVE_LOCKS_REQUIRED(!cs_pending);
@@ -189,7 +241,8 @@ public:
 private:
     void ProcessMessageRecoveredSig(CNode* pfrom, const std::shared_ptr<const CRecoveredSig>& recoveredSig) EXCLUSIVE_LOCKS_REQUIRED(!cs_pending);
 
-    void CollectPendingRecoveredSigsToVerify(size_t maxUniqueSessions,
+    /** Returns the number of unique sessions collected, including those whose quorum is then dropped */
+    size_t CollectPendingRecoveredSigsToVerify(size_t maxUniqueSessions,
             std::unordered_map<NodeId, std::list<std::shared_ptr<const CRecoveredSig>>>& retSigShares,
             std::unordered_map<uint256, CQuorumCPtr, StaticSaltedHasher>& retQuorums) EXCLUSIVE_LOCKS_REQUIRED(!cs_pending);
     void ProcessPendingReconstructedRecoveredSigs() EXCLUSIVE_LOCKS_REQUIRED(!cs_pending, !cs_listeners);
@@ -204,6 +257,12 @@ private:
 public:
     // public interface
     void RegisterRecoveredSigsListener(CRecoveredSigsListener* l) EXCLUSIVE_LOCKS_REQUIRED(!cs_listeners);
+
+    /**
+     * Size of the next verification round. It halves after a round with bad sigs and doubles after a clean round
+     * that collected nBatchSize unique sessions, within MIN_VERIFY_BATCH_SIZE and MAX_VERIFY_BATCH_SIZE
+     */
+    static size_t NextVerifyBatchSize(size_t nBatchSize, size_t nUniqueSessions, bool fBad);
     void UnregisterRecoveredSigsListener(CRecoveredSigsListener* l) EXCLUSIVE_LOCKS_REQUIRED(!cs_listeners);
 
     bool AsyncSignIfMember(const uint256& id, const uint256& msgHash, const uint256& quorumHash = uint256(), bool allowReSign = false);
@@ -219,6 +278,7 @@ public:
     bool IsConflicting(const uint256& id, const uint256& msgHash) const;
 
     bool GetVoteForId(const uint256& id, uint256& msgHashRet) const;
+    CRecoveredSigsCacheStats GetRecoveredSigsCacheStats() const { return db.GetCacheStats(); }
 
 private:
     std::thread workThread;
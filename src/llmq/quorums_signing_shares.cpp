@@ -18,6 +18,10 @@
 #include <cxxtimer.hpp>
 #include <util/thread.h>
 #include <logging.h>
+
+#include <algorithm>
+#include <exception>
+#include <future>
 namespace llmq
 {
 
@@ -178,7 +182,13 @@ void CSigSharesManager::StartWorkerThread()
     if (workThread.joinable()) {
         assert(false);
     }
-     
+
+    nVerifyShards = std::clamp<int>(std::thread::hardware_concurrency() / 2, 1, MAX_VERIFY_THREADS);
+    WITH_LOCK(cs_stats, pipelineStats.nVerifyThreads = nVerifyShards > 1 ? nVerifyShards : 0);
+    // with a single shard verification stays on the work thread
+    if (nVerifyShards > 1) {
+        verifyPool = std::make_unique<ctpl::thread_pool>(nVerifyShards);
+    }
     workThread = std::thread(&util::TraceThread, "sigshares", [this] { WorkThreadMain(); });
 }
 
@@ -192,6 +202,11 @@ void CSigSharesManager::StopWorkerThread()
     if (workThread.joinable()) {
         workThread.join();
     }
+    if (verifyPool) {
+        verifyPool->clear_queue();
+        verifyPool->stop(true);
+        verifyPool.reset();
+    }
 }
 
 void CSigSharesManager::RegisterAsRecoveredSigsListener()
@@ -616,7 +631,8 @@ bool CSigSharesManager::ProcessPendingSigShares()
     std::unordered_map<NodeId, std::vector<CSigShare>> sigSharesByNodes;
     std::unordered_map<uint256, CQuorumCPtr, StaticSaltedHasher> quorums;
 
-    const size_t nMaxBatchSize{32};
+    const size_t nShards{nVerifyShards};
+    const size_t nMaxBatchSize{MAX_VERIFY_BATCH_SESSIONS * nShards};
     bool collect_status = CollectPendingSigSharesToVerify(nMaxBatchSize, sigSharesByNodes, quorums);
     if (!collect_status || sigSharesByNodes.empty()) {
         return false;
@@ -624,7 +640,11 @@ bool CSigSharesManager::ProcessPendingSigShares()
 
     // It's ok to perform insecure batched verification here as we verify against the quorum public key shares,
     // which are not craftable by individual entities, making the rogue public key attack impossible
-    CBLSBatchVerifier<NodeId, SigShareKey> batchVerifier(false, true);
+    std::vector<CBLSBatchVerifier<NodeId, SigShareKey>> batchVerifiers;
+    batchVerifiers.reserve(nShards);
+    for (size_t i = 0; i < nShards; ++i) {
+        batchVerifiers.emplace_back(false, true);
+    }
 
     cxxtimer::Timer prepareTimer(true);
     size_t verifyCount = 0;
@@ -652,6 +672,8 @@ bool CSigSharesManager::ProcessPendingSigShares()
                 assert(false);
             }
 
+            // all shares of a session go to the same shard, so its batch still aggregates them per sign hash
+            auto& batchVerifier = batchVerifiers[GetVerifyShard(sigShare.GetSignHash(), nShards)];
             batchVerifier.PushMessage(nodeId, sigShare.GetKey(), sigShare.GetSignHash(), sigShare.sigShare.Get(), pubKeyShare);
             verifyCount++;
         }
@@ -659,13 +681,16 @@ bool CSigSharesManager::ProcessPendingSigShares()
     prepareTimer.stop();
 
     cxxtimer::Timer verifyTimer(true);
-    batchVerifier.Verify();
+    const std::set<NodeId> badSources{VerifyShards(batchVerifiers, verifyPool.get())};
     verifyTimer.stop();
+    RecordStage(&CSigSharesPipelineStats::verify, verifyCount, verifyTimer.count<std::chrono::microseconds>());
 
-    LogPrint(BCLog::LLMQ_SIGS, "CSigSharesManager::%s -- verified sig shares. count=%d, pt=%d, vt=%d, nodes=%d\n", __func__, verifyCount, prepareTimer.count(), verifyTimer.count(), sigSharesByNodes.size());
+    LogPrint(BCLog::LLMQ_SIGS, "CSigSharesManager::%s -- verified sig shares. count=%d, pt=%d, vt=%d, nodes=%d, shards=%d\n", __func__, verifyCount, prepareTimer.count(), verifyTimer.count(), sigSharesByNodes.size(), nShards);
 
+    cxxtimer::Timer processTimer(true);
+    size_t processCount = 0;
     for (const auto& [nodeId, v] : sigSharesByNodes) {
-        if (batchVerifier.badSources.count(nodeId) != 0) {
+        if (badSources.count(nodeId)) {
             LogPrint(BCLog::LLMQ_SIGS, "CSigSharesManager::%s -- invalid sig shares from other node, banning peer=%d\n",
                      __func__, nodeId);
             // this will also cause re-requesting of the shares that were sent by this node
@@ -674,11 +699,46 @@ bool CSigSharesManager::ProcessPendingSigShares()
         }
 
         ProcessPendingSigShares(v, quorums);
+        processCount += v.size();
     }
+    processTimer.stop();
+    RecordStage(&CSigSharesPipelineStats::process, processCount, processTimer.count<std::chrono::microseconds>());
 
     return sigSharesByNodes.size() >= nMaxBatchSize;
 }
 
+std::set<NodeId> CSigSharesManager::VerifyShards(std::vector<CBLSBatchVerifier<NodeId, SigShareKey>>& batchVerifiers, ctpl::thread_pool* pool)
+{
+    if (batchVerifiers.size() == 1 || !pool) {
+        for (auto& batchVerifier : batchVerifiers) {
+            batchVerifier.Verify();
+        }
+    } else {
+        std::vector<std::future<void>> futures;
+        for (auto& batchVerifier : batchVerifiers) {
+            if (batchVerifier.GetUniqueSourceCount() == 0) {
+                continue;
+            }
+            futures.emplace_back(pool->push([&batchVerifier](int) { batchVerifier.Verify(); }));
+        }
+        // wait for every shard before rethrowing, the pending ones still reference batchVerifiers
+        std::exception_ptr error;
+        for (auto& future : futures) {
+            try {
+                future.get();
+            } catch (...) {
+                if (!error) error = std::current_exception();
+            }
+        }
+        if (error) std::rethrow_exception(error);
+    }
+    std::set<NodeId> badSources;
+    for (const auto& batchVerifier : batchVerifiers) {
+        badSources.insert(batchVerifier.badSources.begin(), batchVerifier.badSources.end());
+    }
+    return badSources;
+}
+
 // It's ensured that no duplicates are passed to this method
 void CSigSharesManager::ProcessPendingSigShares(const std::vector<CSigShare>& sigSharesToProcess,
         const std::unordered_map<uint256, CQuorumCPtr, StaticSaltedHasher>& quorums)
@@ -1456,7 +1516,10 @@ void CSigSharesManager::WorkThreadMain()
         SignPendingSigShares();
 
         if (TicksSinceEpoch<std::chrono::milliseconds>(SystemClock::now()) - lastSendTime > 100) {
+            cxxtimer::Timer sendTimer(true);
             SendMessages();
+            sendTimer.stop();
+            RecordStage(&CSigSharesPipelineStats::send, 1, sendTimer.count<std::chrono::microseconds>());
             lastSendTime = TicksSinceEpoch<std::chrono::milliseconds>(SystemClock::now());
         }
 
@@ -1479,7 +1542,11 @@ void CSigSharesManager::SignPendingSigShares()
 {
     std::vector<PendingSignatureData> v;
     WITH_LOCK(cs_pendingSigns, v.swap(pendingSigns));
+    if (v.empty()) {
+        return;
+    }
 
+    cxxtimer::Timer signTimer(true);
     for (const auto& [pQuorum, id, msgHash] : v) {
         auto opt_sigShare = CreateSigShare(pQuorum, id, msgHash);
 
@@ -1497,6 +1564,31 @@ void CSigSharesManager::SignPendingSigShares()
             }
         }
     }
+    signTimer.stop();
+    RecordStage(&CSigSharesPipelineStats::sign, v.size(), signTimer.count<std::chrono::microseconds>());
+}
+
+void CSigSharesManager::RecordStage(CSigSharesStageStats CSigSharesPipelineStats::*stage, size_t nItems, int64_t nMicros)
+{
+    LOCK(cs_stats);
+    CSigSharesStageStats& stageStats = pipelineStats.*stage;
+    ++stageStats.nRuns;
+    stageStats.nItems += nItems;
+    stageStats.nTotalMicros += nMicros;
+    stageStats.nLastMicros = nMicros;
+}
+
+CSigSharesPipelineStats CSigSharesManager::GetPipelineStats()
+{
+    CSigSharesPipelineStats stats = WITH_LOCK(cs_stats, return pipelineStats);
+    {
+        LOCK(cs);
+        for (const auto& [_, nodeState] : nodeStates) {
+            stats.nPendingIncoming += nodeState.pendingIncomingSigShares.Size();
+        }
+    }
+    stats.nPendingSigns = WITH_LOCK(cs_pendingSigns, return pendingSigns.size());
+    return stats;
 }
 
 std::optional<CSigShare> CSigSharesManager::CreateSigShare(const CQuorumCPtr& quorum, const uint256& id, const uint256& msgHash) const
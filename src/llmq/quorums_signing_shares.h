@@ -7,13 +7,17 @@
 
 #include <llmq/quorums_signing.h>
 
+#include <bls/bls_batchverifier.h>
+#include <ctpl_stl.h>
 #include <serialize.h>
 #include <uint256.h>
+#include <version.h>
 
 #include <atomic>
 #include <limits>
 #include <memory>
 #include <optional>
+#include <set>
 #include <string>
 #include <thread>
 #include <unordered_map>
@@ -117,7 +121,11 @@ public:
         uint64_t invSize = obj.inv.size();
         READWRITE(VARINT(obj.sessionId), COMPACTSIZE(invSize));
         autobitset_t bitset = std::make_pair(obj.inv, (size_t)invSize);
-        READWRITE(AUTOBITSET(bitset));
+        if (s.GetVersion() >= LLMQ_COMPACT_INV_VERSION) {
+            READWRITE(COMPACTBITSET(bitset));
+        } else {
+            READWRITE(AUTOBITSET(bitset));
+        }
         SER_READ(obj, obj.inv = bitset.first);
     }
 
@@ -350,6 +358,25 @@ public:
     int attempt{0};
 };
 
+/** Work done by one stage of the sig share pipeline since startup */
+struct CSigSharesStageStats {
+    uint64_t nRuns{0};
+    uint64_t nItems{0};
+    uint64_t nTotalMicros{0};
+    uint64_t nLastMicros{0};
+};
+
+/** Queue depths and per-stage timings of the sig share pipeline, see quorum_sigsharesinfo */
+struct CSigSharesPipelineStats {
+    size_t nVerifyThreads{0};
+    size_t nPendingIncoming{0};
+    size_t nPendingSigns{0};
+    CSigSharesStageStats verify;
+    CSigSharesStageStats process;
+    CSigSharesStageStats sign;
+    CSigSharesStageStats send;
+};
+
 class CSigSharesManager : public CRecoveredSigsListener
 {
 private:
@@ -367,10 +394,22 @@ private:
     static constexpr int64_t MAX_SEND_FOR_RECOVERY_TIMEOUT{10000};
     static constexpr size_t MAX_MSGS_SIG_SHARES{32};
 
+    // sessions collected per verification shard and round
+    static constexpr size_t MAX_VERIFY_BATCH_SESSIONS{32};
+    static constexpr int MAX_VERIFY_THREADS{4};
+
     RecursiveMutex cs;
 
     std::thread workThread;
     CThreadInterrupt workInterrupt;
+    // pairings of pending shares are checked here, in shards partitioned by sign hash; processing the
+    // verified shares, recovery, signing and sending stay on workThread and keep their order. A stopped
+    // pool cannot be restarted, so it is created by StartWorkerThread and dropped by StopWorkerThread
+    std::unique_ptr<ctpl::thread_pool> verifyPool;
+    size_t nVerifyShards{1};
+
+    mutable Mutex cs_stats;
+    CSigSharesPipelineStats pipelineStats GUARDED_BY(cs_stats);
 
     SigShareMap<CSigShare> sigShares GUARDED_BY(cs);
     std::unordered_map<uint256, CSignedSession, StaticSaltedHasher> signedSessions GUARDED_BY(cs);
@@ -424,8 +463,18 @@ public:
 
     void HandleNewRecoveredSig(const CRecoveredSig& recoveredSig) override;
 
+    CSigSharesPipelineStats GetPipelineStats() EXCLUSIVE_LOCKS_REQUIRED(!cs_pendingSigns, !cs_stats);
+
     static CDeterministicMNCPtr SelectMemberForRecovery(const CQuorumCPtr& quorum, const uint256& id, int attempt);
 
+    /** Shard a pending share is verified in, all shares of a signing session land in the same one */
+    static size_t GetVerifyShard(const uint256& signHash, size_t nShards) { return signHash.GetUint64(0) % nShards; }
+    /**
+     * Verify the shards, in parallel on pool unless there is a single shard or no pool, and return the sources
+     * any shard found bad. An exception thrown while verifying a shard is passed on.
+     */
+    static std::set<NodeId> VerifyShards(std::vector<CBLSBatchVerifier<NodeId, SigShareKey>>& batchVerifiers, ctpl::thread_pool* pool);
+
 private:
     // all of these return false when the currently processed message should be aborted (as each message actually contains multiple messages)
     bool ProcessMessageSigSesAnn(const CNode* pfrom, const CSigSesAnn& ann);
@@ -440,7 +489,7 @@ private:
     bool CollectPendingSigSharesToVerify(
         size_t maxUniqueSessions, std::unordered_map<NodeId, std::vector<CSigShare>>& retSigShares,
         std::unordered_map<uint256, CQuorumCPtr, StaticSaltedHasher>& retQuorums);
-    bool ProcessPendingSigShares();
+    bool ProcessPendingSigShares() EXCLUSIVE_LOCKS_REQUIRED(!cs_stats);
 
     void ProcessPendingSigShares(
         const std::vector<CSigShare>& sigSharesToProcess,
@@ -465,8 +514,9 @@ private:
     void CollectSigSharesToAnnounce(
         std::unordered_map<NodeId, std::unordered_map<uint256, CSigSharesInv, StaticSaltedHasher>>& sigSharesToAnnounce)
         EXCLUSIVE_LOCKS_REQUIRED(cs);
-    void SignPendingSigShares() EXCLUSIVE_LOCKS_REQUIRED(!cs_pendingSigns);
-    void WorkThreadMain() EXCLUSIVE_LOCKS_REQUIRED(!cs_pendingSigns);
+    void SignPendingSigShares() EXCLUSIVE_LOCKS_REQUIRED(!cs_pendingSigns, !cs_stats);
+    void WorkThreadMain() EXCLUSIVE_LOCKS_REQUIRED(!cs_pendingSigns, !cs_stats);
+    void RecordStage(CSigSharesStageStats CSigSharesPipelineStats::*stage, size_t nItems, int64_t nMicros) EXCLUSIVE_LOCKS_REQUIRED(!cs_stats);
 };
 
 extern CSigSharesManager* quorumSigSharesManager;
@@ -69,6 +69,7 @@
 #include <optional>
 #include <typeinfo>
 #include <common/args.h>
+#include <services/nevmconsensus.h>
 /** Headers download timeout.
  *  Timeout = base + per_header * (expected number of headers) */
 static constexpr auto HEADERS_DOWNLOAD_TIMEOUT_BASE = 15min;
@@ -1875,6 +1876,8 @@ void PeerManagerImpl::NewPoWValidBlock(const CBlockIndex *pindex, const std::sha
 {
     auto pcmpctblock = std::make_shared<const CBlockHeaderAndShortTxIDs>(*pblock);
     const CNetMsgMaker msgMaker(PROTOCOL_VERSION);
+    // SYSCOIN peers before PODA_COMPACT_BLOCKS_VERSION get the compact block without PoDA version hashes
+    const CNetMsgMaker msgMakerLegacy(PODA_COMPACT_BLOCKS_VERSION - 1);
 
     LOCK(cs_main);
 
@@ -1887,6 +1890,8 @@ void PeerManagerImpl::NewPoWValidBlock(const CBlockIndex *pindex, const std::sha
     uint256 hashBlock(pblock->GetHash());
     const std::shared_future<CSerializedNetMsg> lazy_ser{
         std::async(std::launch::deferred, [&] { return msgMaker.Make(NetMsgType::CMPCTBLOCK, *pcmpctblock); })};
+    const std::shared_future<CSerializedNetMsg> lazy_ser_legacy{
+        std::async(std::launch::deferred, [&] { return msgMakerLegacy.Make(NetMsgType::CMPCTBLOCK, *pcmpctblock); })};
 
     {
         auto most_recent_block_txs = std::make_unique<std::map<uint256, CTransactionRef>>();
@@ -1902,7 +1907,7 @@ void PeerManagerImpl::NewPoWValidBlock(const CBlockIndex *pindex, const std::sha
         m_most_recent_block_txs = std::move(most_recent_block_txs);
     }
 
-    m_connman.ForEachNode([this, pindex, &lazy_ser, &hashBlock](CNode* pnode) EXCLUSIVE_LOCKS_REQUIRED(::cs_main) {
+    m_connman.ForEachNode([this, pindex, &lazy_ser, &lazy_ser_legacy, &hashBlock](CNode* pnode) EXCLUSIVE_LOCKS_REQUIRED(::cs_main) {
         AssertLockHeld(::cs_main);
 
         if (pnode->GetCommonVersion() < INVALID_CB_NO_BAN_VERSION || pnode->fDisconnect)
@@ -1916,7 +1921,7 @@ void PeerManagerImpl::NewPoWValidBlock(const CBlockIndex *pindex, const std::sha
             LogPrint(BCLog::NET, "%s sending header-and-ids %s to peer=%d\n", "PeerManager::NewPoWValidBlock",
                     hashBlock.ToString(), pnode->GetId());
 
-            const CSerializedNetMsg& ser_cmpctblock{lazy_ser.get()};
+            const CSerializedNetMsg& ser_cmpctblock{pnode->GetCommonVersion() >= PODA_COMPACT_BLOCKS_VERSION ? lazy_ser.get() : lazy_ser_legacy.get()};
             m_connman.PushMessage(pnode, ser_cmpctblock.Copy());
             state.pindexBestHeaderSent = pindex;
         }
@@ -2258,30 +2263,32 @@ void PeerManagerImpl::ProcessGetBlockData(CNode& pfrom, Peer& peer, const CInv&
     std::shared_ptr<const CBlock> pblock;
     // SYSCOIN
     bool bRecent = false;
+    // blocks from disk sent as BLOCK keep their PoDA blobs out, those are streamed in while serializing
+    bool bBlobsStripped = false;
     if (a_recent_block && a_recent_block->GetHash() == pindex->GetBlockHash()) {
         pblock = a_recent_block;
         bRecent = true;
-    } else if (inv.IsMsgWitnessBlk()) {
-        // SYSCOIN
-        // Send block from disk
-        std::shared_ptr<CBlock> pblockRead = std::make_shared<CBlock>();
-        if (!m_chainman.m_blockman.ReadBlockFromDisk(*pblockRead, *pindex)) {
-            assert(!"cannot load block from disk");
-        }
-        pblock = pblockRead;
     } else {
         // Send block from disk
+        bBlobsStripped = inv.IsMsgBlk() || inv.IsMsgWitnessBlk();
         std::shared_ptr<CBlock> pblockRead = std::make_shared<CBlock>();
-        if (!m_chainman.m_blockman.ReadBlockFromDisk(*pblockRead, *pindex)) {
+        if (!m_chainman.m_blockman.ReadBlockFromDisk(*pblockRead, *pindex, /*fFillNEVMData=*/!bBlobsStripped)) {
             assert(!"cannot load block from disk");
         }
         pblock = pblockRead;
     }
     if (pblock) {
-        if (inv.IsMsgBlk()) {
-            m_connman.PushMessage(&pfrom, msgMaker.Make(SERIALIZE_TRANSACTION_NO_WITNESS, NetMsgType::BLOCK, *pblock));
-        } else if (inv.IsMsgWitnessBlk()) {
-            m_connman.PushMessage(&pfrom, msgMaker.Make(NetMsgType::BLOCK, *pblock));
+        if (inv.IsMsgBlk() || inv.IsMsgWitnessBlk()) {
+            const int nFlags = inv.IsMsgBlk() ? SERIALIZE_TRANSACTION_NO_WITNESS : 0;
+            if (bBlobsStripped) {
+                CBlockWithNEVMData blockWithData{*pblock};
+                if (!blockWithData.Load()) {
+                    assert(!"cannot load block from disk");
+                }
+                m_connman.PushMessage(&pfrom, msgMaker.Make(nFlags, NetMsgType::BLOCK, blockWithData));
+            } else {
+                m_connman.PushMessage(&pfrom, msgMaker.Make(nFlags, NetMsgType::BLOCK, *pblock));
+            }
         } else if (inv.IsMsgFilteredBlk()) {
             bool sendMerkleBlock = false;
             CMerkleBlock merkleBlock;
@@ -2567,6 +2574,16 @@ void PeerManagerImpl::SendBlockTransactions(CNode& pfrom, Peer& peer, const CBlo
         }
         resp.txn[i] = block.vtx[req.indexes[i]];
     }
+    // SYSCOIN the peer stores these blobs already, send their transactions without them
+    for (const uint16_t index : req.nevm_stripped_indexes) {
+        const auto it = std::lower_bound(req.indexes.begin(), req.indexes.end(), index);
+        if (it == req.indexes.end() || *it != index) {
+            Misbehaving(peer, 100, "getblocktxn with stripped tx indices that were not requested");
+            return;
+        }
+        auto& tx = resp.txn[it - req.indexes.begin()];
+        tx = StripNEVMData(tx);
+    }
 
     const CNetMsgMaker msgMaker(pfrom.GetCommonVersion());
     m_connman.PushMessage(&pfrom, msgMaker.Make(NetMsgType::BLOCKTXN, resp));
@@ -4734,8 +4751,12 @@ void PeerManagerImpl::ProcessMessage(CNode& pfrom, const std::string& msg_type,
 
                 BlockTransactionsRequest req;
                 for (size_t i = 0; i < cmpctblock.BlockTxCount(); i++) {
-                    if (!partialBlock.IsTxAvailable(i))
+                    if (!partialBlock.IsTxAvailable(i)) {
                         req.indexes.push_back(i);
+                        // SYSCOIN
+                        if (partialBlock.IsBlobAvailable(i))
+                            req.nevm_stripped_indexes.push_back(i);
+                    }
                 }
                 if (req.indexes.empty()) {
                     fProcessBLOCKTXN = true;
@@ -3,9 +3,22 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 #include <nevm/nevm.h>
 #include <nevm/sha3.h>
-#include <util/strencodings.h>
 
-static bool MatchProofValue(dev::bytes node_value,
+#include <cstring>
+
+/** Byte-wise equality of two views into proof buffers */
+static bool RefEquals(dev::bytesConstRef a, dev::bytesConstRef b)
+{
+  return a.size() == b.size() && (a.empty() || std::memcmp(a.data(), b.data(), a.size()) == 0);
+}
+
+/** The i'th nibble of a byte string, high nibble first */
+static uint8_t NibbleAt(dev::bytesConstRef bytes, size_t i)
+{
+  return (i & 1) ? (bytes[i >> 1] & 0x0f) : (bytes[i >> 1] >> 4);
+}
+
+static bool MatchProofValue(dev::bytesConstRef node_value,
                             const dev::RLP& expected_value,
                             std::optional<uint8_t>* envelope_type)
 {
@@ -19,9 +32,9 @@ static bool MatchProofValue(dev::bytes node_value,
   // separately whitelists the authenticated type values it understands.
   if(node_value[0] <= 0x7f) {
     parsed_type = node_value[0];
-    node_value.erase(node_value.begin());
+    node_value = node_value.cropped(1);
   }
-  if(node_value != expected_value.data().toBytes()) {
+  if(!RefEquals(node_value, expected_value.data())) {
     return false;
   }
   if(envelope_type) {
@@ -30,27 +43,9 @@ static bool MatchProofValue(dev::bytes node_value,
   return true;
 }
 
-int nibblesToTraverse(const std::string &encodedPartialPath, const std::string &path, int pathPtr) {
-  if(encodedPartialPath.empty()) {
-    return -1;
-  }
-  std::string partialPath;
-  // typecast as the character
-  uint8_t partialPathInt; 
-  char pathPtrInt[2] = {encodedPartialPath[0], '\0'};
-  if(!ParseUInt8(pathPtrInt, &partialPathInt))
-    return -1;
-  if(partialPathInt == 0 || partialPathInt == 2){
-    partialPath = encodedPartialPath.substr(2);
-  }else{
-    partialPath = encodedPartialPath.substr(1);
-  }
-  if(partialPath == path.substr(pathPtr, partialPath.size())){
-    return partialPath.size();
-  }else{
-    return -1;
-  }
-}
+// The walker decodes in place: nodes, keys and values are views into the
+// proof buffer and the path is read nibble by nibble, so verifying a proof
+// does not allocate.
 bool VerifyProof(dev::bytesConstRef path,
                  const dev::RLP& value,
                  const dev::RLP& parentNodes,
@@ -58,37 +53,30 @@ bool VerifyProof(dev::bytesConstRef path,
                  std::optional<uint8_t>* envelope_type) {
   
   dev::RLP currentNode;
-  const int len = parentNodes.itemCount();
+  const size_t len = parentNodes.itemCount();
   dev::RLP nodeKey = root;       
-  int pathPtr = 0;
+  const size_t pathNibbles = path.size() * 2;
+  size_t pathPtr = 0;
 
-  const std::string pathString = dev::toHex(path);
-  int nibbles;
-  char pathPtrInt[2];
-  uint8_t pathInt;
-  for (int i = 0 ; i < len ; i++) {
+  for (size_t i = 0 ; i < len ; i++) {
     currentNode = parentNodes[i];
-    if(!nodeKey.payload().contentsEqual(sha3(currentNode.data()).ref().toVector())){
+    const dev::h256 nodeHash = sha3(currentNode.data());
+    if(!RefEquals(nodeKey.payload(), nodeHash.ref())){
       return false;
     } 
 
-    if(pathPtr > (int)pathString.size()){
+    if(pathPtr > pathNibbles){
       return false;
     }
     switch(currentNode.itemCount()){
       case 17://branch node
-        if(pathPtr == (int)pathString.size()){
+        if(pathPtr == pathNibbles){
           // RLP-encoded transaction/receipt indexes are prefix-free, so
           // canonical Ethereum tries terminate these proofs at leaf nodes.
           // Keep generic MPT branch-value handling consistent with leaves.
-          return MatchProofValue(currentNode[16].toBytes(), value, envelope_type);
-        }
-        pathPtrInt[0] = pathString[pathPtr];
-        pathPtrInt[1] = '\0';
-        if(!ParseUInt8FromHex(pathPtrInt, &pathInt)) {
-          return false;
+          return MatchProofValue(currentNode[16].toBytesConstRef(), value, envelope_type);
         }
-        nodeKey = currentNode[pathInt]; //must == sha3(rlp.encode(currentNode[path[pathptr]]))
+        nodeKey = currentNode[NibbleAt(path, pathPtr)]; //must == sha3(rlp.encode(currentNode[path[pathptr]]))
         pathPtr += 1;
         break;
       case 2:
@@ -96,7 +84,7 @@ bool VerifyProof(dev::bytesConstRef path,
         if(!currentNode[0].isData()) {
           return false;
         }
-        const dev::bytes compact = currentNode[0].toBytes();
+        const dev::bytesConstRef compact = currentNode[0].toBytesConstRef();
         if(compact.empty()) {
           return false;
         }
@@ -118,19 +106,23 @@ bool VerifyProof(dev::bytesConstRef path,
         if(!is_leaf && !is_odd && compact.size() == 1) {
           return false;
         }
-        const std::string encodedPartialPath = toHex(
-            dev::bytesConstRef(compact.data(), compact.size()));
-        nibbles = nibblesToTraverse(encodedPartialPath, pathString, pathPtr);
-        if(nibbles <= -1) {
+        // the partial path starts after the flag nibble, and after the padding nibble when even
+        const size_t partialStart = is_odd ? 1 : 2;
+        const size_t nibbles = compact.size() * 2 - partialStart;
+        if(nibbles > pathNibbles - pathPtr) {
           return false;
         }
+        for (size_t n = 0; n < nibbles; n++) {
+          if(NibbleAt(compact, partialStart + n) != NibbleAt(path, pathPtr + n)) {
+            return false;
+          }
+        }
         pathPtr += nibbles;
         if(is_leaf) {
-          if(pathPtr != (int)pathString.size()) {
+          if(pathPtr != pathNibbles) {
             return false;
           }
-          dev::bytes nodeVec(currentNode[1].toBytes());
-          return MatchProofValue(std::move(nodeVec), value, envelope_type);
+          return MatchProofValue(currentNode[1].toBytesConstRef(), value, envelope_type);
         }
         // Extension: follow the child. After a nonempty extension the remaining
         // path may be empty when the child is a branch value slot.
@@ -144,4 +136,3 @@ bool VerifyProof(dev::bytesConstRef path,
   
   return false;
 }
-
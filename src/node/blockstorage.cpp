@@ -1103,11 +1103,11 @@ bool BlockManager::ReadBlockFromDisk(CBlock& block, const FlatFilePos& pos) cons
     return res;
 }
 
-bool BlockManager::ReadBlockFromDisk(CBlock& block, const CBlockIndex& index) const
+bool BlockManager::ReadBlockFromDisk(CBlock& block, const CBlockIndex& index, bool fFillNEVMData) const
 {
     auto res = ReadBlockOrHeader(block, index);
     // SYSCOIN
-    if(!FillNEVMData(block)) {
+    if(fFillNEVMData && !FillNEVMData(block)) {
         return error("ReadBlockFromDisk(): FillNEVMData() failed for %s",
         index.GetBlockHash().GetHex());
     }
@@ -374,7 +374,9 @@ public:
 
     /** Functions for disk access for blocks */
     bool ReadBlockFromDisk(CBlock& block, const FlatFilePos& pos) const;
-    bool ReadBlockFromDisk(CBlock& block, const CBlockIndex& index) const;
+    // SYSCOIN
+    /** PoDA blobs are only filled in with fFillNEVMData, see CBlockWithNEVMData for serving blocks without them */
+    bool ReadBlockFromDisk(CBlock& block, const CBlockIndex& index, bool fFillNEVMData = true) const;
     bool ReadRawBlockFromDisk(std::vector<uint8_t>& block, const FlatFilePos& pos) const;
 
     bool UndoReadFromDisk(CBlockUndo& blockundo, const CBlockIndex& index) const;
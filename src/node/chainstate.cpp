@@ -148,7 +148,14 @@ static ChainstateLoadResult CompleteChainstateInitialization(
         .cache_bytes = static_cast<size_t>(cache_sizes.evo_poda_db),
         .memory_only = options.block_tree_db_in_memory,
         .wipe_data = false,
-        .options = chainman.m_options.coins_db});  
+        .options = chainman.m_options.coins_db}, options.nevm_blob_cache_bytes);
+    if (!pnevmdatablobdb->Upgrade(options.check_interrupt)) {
+        if (options.check_interrupt && options.check_interrupt()) return {ChainstateLoadStatus::INTERRUPTED, {}};
+        return {ChainstateLoadStatus::FAILURE, _("Error upgrading NEVM blob database")};
+    }
+    if (!pnevmdatadb->Upgrade()) {
+        return {ChainstateLoadStatus::FAILURE, _("Error upgrading NEVM data database")};
+    }
     if (options.check_interrupt && options.check_interrupt()) return {ChainstateLoadStatus::INTERRUPTED, {}};
 
     // LoadBlockIndex will load m_have_pruned if we've ever removed a
@@ -322,7 +329,14 @@ static ChainstateLoadResult CompleteChainstateInitialization(
             .cache_bytes = static_cast<size_t>(cache_sizes.evo_poda_db),
             .memory_only = options.block_tree_db_in_memory,
             .wipe_data = false,
-            .options = chainman.m_options.coins_db});  
+            .options = chainman.m_options.coins_db}, options.nevm_blob_cache_bytes);
+        if (!pnevmdatablobdb->Upgrade(options.check_interrupt)) {
+            if (options.check_interrupt && options.check_interrupt()) return {ChainstateLoadStatus::INTERRUPTED, {}};
+            return {ChainstateLoadStatus::FAILURE, _("Error upgrading NEVM blob database")};
+        }
+        if (!pnevmdatadb->Upgrade()) {
+            return {ChainstateLoadStatus::FAILURE, _("Error upgrading NEVM data database")};
+        }
     } else if (coinsViewEmpty) {
         // SYSCOIN Continued reindex already reinitialized reconstructible NEVM DBs above
         // via effective_reindex_geth, which skips the block above. nevmminttx still
@@ -337,6 +351,9 @@ static ChainstateLoadResult CompleteChainstateInitialization(
             .options = chainman.m_options.block_tree_db});
     }
 
+    // SYSCOIN the stored mint replay filter is only trusted for the tip it was written with
+    pnevmtxmintdb->LoadFilter(chainman.ActiveChainstate().CoinsTip().GetBestBlock());
+
     // Now that chainstates are loaded and we're able to flush to
     // disk, rebalance the coins caches to desired levels based
     // on the condition of each chainstate.
@@ -5,6 +5,7 @@
 #ifndef SYSCOIN_NODE_CHAINSTATE_H
 #define SYSCOIN_NODE_CHAINSTATE_H
 
+#include <services/nevmconsensus.h>
 #include <util/translation.h>
 #include <validation.h>
 
@@ -43,6 +44,8 @@ struct ChainstateLoadOptions {
     BanMan* banman{nullptr};
     PeerManager* peerman{nullptr};
     bool fReindexGeth{false};
+    //! Byte budget of the in-memory cache of recently used PoDA blobs.
+    size_t nevm_blob_cache_bytes{DEFAULT_NEVM_BLOB_CACHE_MB << 20};
 };
 
 //! Chainstate load status. Simple applications can just check for the success
@@ -44,6 +44,13 @@ util::Result<void> ApplyArgsManOptions(const ArgsManager& args, ChainstateManage
     if (auto value{args.GetBoolArg("-reindex")}) opts.reindex = *value;
     else if (auto value{args.GetBoolArg("-reindex-chainstate")}) opts.reindex = *value;
 
+    if (auto value{args.GetIntArg("-nevmconnectwindow")}) {
+        if (*value < 1 || *value > MAX_NEVM_CONNECT_WINDOW) {
+            return util::Error{strprintf(Untranslated("-nevmconnectwindow must be between 1 and %d"), MAX_NEVM_CONNECT_WINDOW)};
+        }
+        opts.nevm_connect_window = *value;
+    }
+
     opts.datadir_base = args.GetDataDirBase();
 
     ReadDatabaseArgs(args, opts.block_tree_db);
@@ -0,0 +1 @@
+#define BUILD_GIT_COMMIT "e3a90462ed21-dirty"
@@ -10,6 +10,8 @@
 #include <chainparams.h>
 #include <core_io.h>
 #include <httpserver.h>
+#include <key_io.h>
+#include <index/assetallocationindex.h>
 #include <index/blockfilterindex.h>
 #include <index/txindex.h>
 #include <node/blockstorage.h>
@@ -21,11 +23,15 @@
 #include <rpc/protocol.h>
 #include <rpc/server.h>
 #include <rpc/server_util.h>
+#include <services/assetconsensus.h>
+#include <services/nevmconsensus.h>
+#include <services/rpc/assetrpc.h>
 #include <streams.h>
 #include <sync.h>
 #include <txmempool.h>
 #include <util/any.h>
 #include <util/check.h>
+#include <util/strencodings.h>
 #include <validation.h>
 #include <version.h>
 
@@ -39,6 +45,10 @@ using node::NodeContext;
 
 static const size_t MAX_GETUTXOS_OUTPOINTS = 15; //allow a max of 15 outpoints to be queried at once
 static constexpr unsigned int MAX_REST_HEADERS_RESULTS = 2000;
+// SYSCOIN
+static constexpr unsigned int MAX_REST_NEVMBLOBS = 64; //allow a max of 64 blobs to be fetched at once
+//! Length written in place of a blob's size in the batch response when the blob is not stored
+static constexpr uint32_t NEVMBLOB_NOT_FOUND = 0xffffffff;
 
 static const struct {
     RESTResponseFormat rf;
@@ -1018,6 +1028,376 @@ static bool rest_blockhash_by_height(const std::any& context, HTTPRequest* req,
     }
 }
 
+// SYSCOIN
+static bool ParseVersionHash(const std::string& strHash, std::vector<uint8_t>& vchVersionHash)
+{
+    if (strHash.size() != 64 || !IsHex(strHash)) {
+        return false;
+    }
+    vchVersionHash = ParseHex(strHash);
+    return true;
+}
+
+/** Whether an If-None-Match header lists the given entity tag; weak tags compare equal to their strong form */
+static bool ETagMatches(const std::string& strHeader, const std::string& strETag)
+{
+    for (const std::string& strPart : SplitString(strHeader, ',')) {
+        std::string_view strTag = TrimStringView(strPart);
+        if (strTag == "*") {
+            return true;
+        }
+        if (strTag.substr(0, 2) == "W/") {
+            strTag.remove_prefix(2);
+        }
+        if (strTag == strETag) {
+            return true;
+        }
+    }
+    return false;
+}
+
+enum class ByteRange {
+    NONE,          //!< no usable range, serve the whole blob
+    VALID,         //!< serve [nStart, nEnd]
+    UNSATISFIABLE, //!< the range lies outside the blob
+};
+
+/**
+ * Parse a single "bytes=" range (RFC 9110) against a body of nSize bytes.
+ * Malformed headers and multiple ranges are ignored, which the RFC permits.
+ */
+static ByteRange ParseByteRange(const std::string& strRange, uint64_t nSize, uint64_t& nStart, uint64_t& nEnd)
+{
+    const std::string_view strSpec = TrimStringView(strRange);
+    if (strSpec.substr(0, 6) != "bytes=" || strSpec.find(',') != std::string_view::npos) {
+        return ByteRange::NONE;
+    }
+    const std::string_view strSet = TrimStringView(strSpec.substr(6));
+    const auto nDash = strSet.find('-');
+    if (nDash == std::string_view::npos) {
+        return ByteRange::NONE;
+    }
+    const std::string strFirst{strSet.substr(0, nDash)};
+    const std::string strLast{strSet.substr(nDash + 1)};
+    if (strFirst.empty()) {
+        // suffix range: the last N bytes
+        const auto nSuffix = ToIntegral<uint64_t>(strLast);
+        if (!nSuffix) return ByteRange::NONE;
+        if (*nSuffix == 0 || nSize == 0) return ByteRange::UNSATISFIABLE;
+        nStart = nSize > *nSuffix ? nSize - *nSuffix : 0;
+        nEnd = nSize - 1;
+        return ByteRange::VALID;
+    }
+    const auto nFirst = ToIntegral<uint64_t>(strFirst);
+    if (!nFirst) return ByteRange::NONE;
+    uint64_t nLast = std::numeric_limits<uint64_t>::max();
+    if (!strLast.empty()) {
+        const auto nLastParsed = ToIntegral<uint64_t>(strLast);
+        if (!nLastParsed || *nLastParsed < *nFirst) return ByteRange::NONE;
+        nLast = *nLastParsed;
+    }
+    if (*nFirst >= nSize) return ByteRange::UNSATISFIABLE;
+    nStart = *nFirst;
+    nEnd = std::min(nLast, nSize - 1);
+    return ByteRange::VALID;
+}
+
+static bool rest_nevmblob(const std::any& context, HTTPRequest* req, const std::string& strURIPart)
+{
+    if (!CheckWarmup(req))
+        return false;
+    std::string hashStr;
+    const RESTResponseFormat rf = ParseDataFormat(hashStr, strURIPart);
+    if (rf != RESTResponseFormat::BINARY) {
+        return RESTERR(req, HTTP_NOT_FOUND, "output format not found (available: .bin)");
+    }
+    std::vector<uint8_t> vchVersionHash;
+    if (!ParseVersionHash(hashStr, vchVersionHash)) {
+        return RESTERR(req, HTTP_BAD_REQUEST, "Invalid version hash: " + hashStr);
+    }
+    CNEVMBlobView view;
+    if (!pnevmdatablobdb || !pnevmdatablobdb->ReadBlobView(vchVersionHash, view)) {
+        return RESTERR(req, HTTP_NOT_FOUND, hashStr + " not found");
+    }
+    // the version hash commits to the blob contents, so it is a strong validator for caches
+    const std::string strETag = "\"" + HexStr(vchVersionHash) + "\"";
+    req->WriteHeader("ETag", strETag);
+    req->WriteHeader("Accept-Ranges", "bytes");
+    const auto [fIfNoneMatch, strIfNoneMatch] = req->GetHeader("If-None-Match");
+    if (fIfNoneMatch && ETagMatches(strIfNoneMatch, strETag)) {
+        req->WriteReply(HTTP_NOT_MODIFIED);
+        return true;
+    }
+
+    Span<const uint8_t> data = view.data;
+    int nStatus = HTTP_OK;
+    const auto [fRange, strRange] = req->GetHeader("Range");
+    const auto [fIfRange, strIfRange] = req->GetHeader("If-Range");
+    if (fRange && (!fIfRange || TrimString(strIfRange) == strETag)) {
+        uint64_t nStart{0}, nEnd{0};
+        switch (ParseByteRange(strRange, data.size(), nStart, nEnd)) {
+        case ByteRange::UNSATISFIABLE:
+            req->WriteHeader("Content-Range", strprintf("bytes */%u", data.size()));
+            return RESTERR(req, HTTP_RANGE_NOT_SATISFIABLE, "Requested range not satisfiable");
+        case ByteRange::VALID:
+            req->WriteHeader("Content-Range", strprintf("bytes %u-%u/%u", nStart, nEnd, data.size()));
+            data = data.subspan(nStart, nEnd - nStart + 1);
+            nStatus = HTTP_PARTIAL_CONTENT;
+            break;
+        case ByteRange::NONE:
+            break;
+        }
+    }
+    req->WriteHeader("Content-Type", "application/octet-stream");
+    // hand the mapped blob to libevent directly, the mapping stays alive until it is sent
+    req->AppendReplyReference(MakeByteSpan(data), view.mapping);
+    req->WriteReply(nStatus);
+    return true;
+}
+
+static bool rest_nevmblobs(const std::any& context, HTTPRequest* req, const std::string& strURIPart)
+{
+    if (!CheckWarmup(req))
+        return false;
+    std::string param;
+    const RESTResponseFormat rf = ParseDataFormat(param, strURIPart);
+    if (rf != RESTResponseFormat::BINARY) {
+        return RESTERR(req, HTTP_NOT_FOUND, "output format not found (available: .bin)");
+    }
+    std::vector<std::string> path = SplitString(param, '/');
+    if (!path.empty() && path.front().empty()) {
+        path.erase(path.begin());
+    }
+    if (path.empty()) {
+        return RESTERR(req, HTTP_BAD_REQUEST, "No version hashes specified. Use /rest/nevmblobs/<versionhash>/<versionhash>/.../<versionhash>.bin");
+    }
+    if (path.size() > MAX_REST_NEVMBLOBS) {
+        return RESTERR(req, HTTP_BAD_REQUEST, strprintf("Error: max version hashes exceeded (max: %d)", MAX_REST_NEVMBLOBS));
+    }
+    std::vector<std::vector<uint8_t>> vecVersionHashes(path.size());
+    for (size_t i = 0; i < path.size(); i++) {
+        if (!ParseVersionHash(path[i], vecVersionHashes[i])) {
+            return RESTERR(req, HTTP_BAD_REQUEST, "Invalid version hash: " + path[i]);
+        }
+    }
+    if (!pnevmdatablobdb) {
+        return RESTERR(req, HTTP_NOT_FOUND, "NEVM blob store not available");
+    }
+    // each entry is the 32 byte version hash and a 4 byte little-endian length followed by that many bytes,
+    // blobs that are not stored carry NEVMBLOB_NOT_FOUND as their length and no data
+    static constexpr size_t ENTRY_HEADER_SIZE = 32 + 4;
+    auto vchHeaders = std::make_shared<std::vector<unsigned char>>(ENTRY_HEADER_SIZE * vecVersionHashes.size());
+    std::vector<CNEVMBlobView> vecViews(vecVersionHashes.size());
+    for (size_t i = 0; i < vecVersionHashes.size(); i++) {
+        unsigned char* pHeader = vchHeaders->data() + ENTRY_HEADER_SIZE * i;
+        std::copy(vecVersionHashes[i].begin(), vecVersionHashes[i].end(), pHeader);
+        const bool fFound = pnevmdatablobdb->ReadBlobView(vecVersionHashes[i], vecViews[i]);
+        WriteLE32(pHeader + 32, fFound ? static_cast<uint32_t>(vecViews[i].data.size()) : NEVMBLOB_NOT_FOUND);
+    }
+    for (size_t i = 0; i < vecViews.size(); i++) {
+        req->AppendReplyReference(MakeByteSpan(Span{*vchHeaders}.subspan(ENTRY_HEADER_SIZE * i, ENTRY_HEADER_SIZE)), vchHeaders);
+        req->AppendReplyReference(MakeByteSpan(vecViews[i].data), vecViews[i].mapping);
+    }
+    req->WriteHeader("Content-Type", "application/octet-stream");
+    req->WriteReply(HTTP_OK);
+    return true;
+}
+
+static bool rest_assetallocation(const std::any& context, HTTPRequest* req, const std::string& strURIPart)
+{
+    if (!CheckWarmup(req))
+        return false;
+    std::string param;
+    const RESTResponseFormat rf = ParseDataFormat(param, strURIPart);
+    if (rf != RESTResponseFormat::JSON) {
+        return RESTERR(req, HTTP_NOT_FOUND, "output format not found (available: json)");
+    }
+    const std::vector<std::string> path = SplitString(param, '/');
+    if (path.empty() || path.size() > 2 || path[0].empty()) {
+        return RESTERR(req, HTTP_BAD_REQUEST, "Invalid URI format. Expected /rest/assetallocation/<address>.json or /rest/assetallocation/<address>/<asset_guid>.json");
+    }
+    const CTxDestination dest = DecodeDestination(path[0]);
+    if (!IsValidDestination(dest)) {
+        return RESTERR(req, HTTP_BAD_REQUEST, "Invalid address: " + path[0]);
+    }
+    if (!g_asset_allocation_index) {
+        return RESTERR(req, HTTP_SERVICE_UNAVAILABLE, "Asset allocation index is not enabled, start with -assetallocationindex");
+    }
+    if (!g_asset_allocation_index->BlockUntilSyncedToCurrentChain()) {
+        return RESTERR(req, HTTP_SERVICE_UNAVAILABLE, "Asset allocation index is still syncing");
+    }
+    const CScript script = GetScriptForDestination(dest);
+    if (path.size() == 1) {
+        std::string strJSON = AssetAllocationBalancesToJSON(g_asset_allocation_index->FindBalances(script)).write() + "\n";
+        req->WriteHeader("Content-Type", "application/json");
+        req->WriteReply(HTTP_OK, strJSON);
+        return true;
+    }
+    const auto nAsset = ToIntegral<uint64_t>(path[1]);
+    if (!nAsset) {
+        return RESTERR(req, HTTP_BAD_REQUEST, "Invalid asset guid: " + path[1]);
+    }
+    std::optional<int> nFromHeight{0};
+    std::optional<size_t> nCount{MAX_ASSETALLOCATION_HISTORY};
+    try {
+        if (const auto from_height = req->GetQueryParameter("from_height")) nFromHeight = ToIntegral<int>(*from_height);
+        if (const auto count = req->GetQueryParameter("count")) nCount = ToIntegral<size_t>(*count);
+    } catch (const std::runtime_error& e) {
+        return RESTERR(req, HTTP_BAD_REQUEST, e.what());
+    }
+    if (!nFromHeight || *nFromHeight < 0) {
+        return RESTERR(req, HTTP_BAD_REQUEST, "Invalid from_height");
+    }
+    if (!nCount || *nCount < 1 || *nCount > MAX_ASSETALLOCATION_HISTORY) {
+        return RESTERR(req, HTTP_BAD_REQUEST, strprintf("count must be between 1 and %d", MAX_ASSETALLOCATION_HISTORY));
+    }
+    CAmount nBalance{0};
+    g_asset_allocation_index->FindBalance(script, *nAsset, nBalance);
+    UniValue result(UniValue::VOBJ);
+    result.pushKV("asset_guid", *nAsset);
+    result.pushKV("balance", ValueFromAmount(nBalance));
+    result.pushKV("history", AssetAllocationHistoryToJSON(g_asset_allocation_index->FindHistory(script, *nAsset, *nFromHeight, *nCount)));
+    std::string strJSON = result.write() + "\n";
+    req->WriteHeader("Content-Type", "application/json");
+    req->WriteReply(HTTP_OK, strJSON);
+    return true;
+}
+
+/**
+ * Read the hashes of a batched NEVM lookup, either from the URI (/<hash>/<hash>/...) or, for binary and
+ * hex requests, from the body as a serialized vector of hashes. Writes the error reply on failure.
+ */
+static bool ParseNEVMHashRequest(HTTPRequest* req, const std::string& param, RESTResponseFormat rf, std::vector<uint256>& vecHashes)
+{
+    std::vector<std::string> path = SplitString(param, '/');
+    if (!path.empty() && path.front().empty()) {
+        path.erase(path.begin());
+    }
+    std::string strBody = req->ReadBody();
+    if (!path.empty() && !strBody.empty()) {
+        return RESTERR(req, HTTP_BAD_REQUEST, "Combination of URI scheme inputs and raw post data is not allowed");
+    }
+    if (path.size() > MAX_NEVM_BATCH_LOOKUP) {
+        return RESTERR(req, HTTP_BAD_REQUEST, strprintf("Error: max hashes exceeded (max: %d)", MAX_NEVM_BATCH_LOOKUP));
+    }
+    for (const std::string& strHash : path) {
+        uint256 hash;
+        if (!ParseHashStr(RemovePrefix(strHash, "0x"), hash)) {
+            return RESTERR(req, HTTP_BAD_REQUEST, "Invalid hash: " + strHash);
+        }
+        vecHashes.push_back(hash);
+    }
+    if (!strBody.empty()) {
+        if (rf == RESTResponseFormat::JSON) {
+            return RESTERR(req, HTTP_BAD_REQUEST, "Raw post data requires .bin or .hex");
+        }
+        if (rf == RESTResponseFormat::HEX) {
+            const std::vector<unsigned char> vchBody = ParseHex(strBody);
+            strBody.assign(vchBody.begin(), vchBody.end());
+        }
+        try {
+            DataStream ss{MakeByteSpan(strBody)};
+            // check the count before the vector is allocated
+            const uint64_t nCount = ReadCompactSize(ss, /*range_check=*/false);
+            if (nCount > MAX_NEVM_BATCH_LOOKUP) {
+                return RESTERR(req, HTTP_BAD_REQUEST, strprintf("Error: max hashes exceeded (max: %d)", MAX_NEVM_BATCH_LOOKUP));
+            }
+            vecHashes.resize(nCount);
+            for (uint256& hash : vecHashes) {
+                ss >> hash;
+            }
+        } catch (const std::ios_base::failure&) {
+            return RESTERR(req, HTTP_BAD_REQUEST, "Parse error");
+        }
+    }
+    if (vecHashes.empty()) {
+        return RESTERR(req, HTTP_BAD_REQUEST, "Error: empty request");
+    }
+    return true;
+}
+
+/** Reply with the bitmap of hashes found, followed by extra serialized data for the binary and hex formats */
+static bool WriteNEVMLookupReply(HTTPRequest* req, RESTResponseFormat rf, const std::vector<bool>& vecFound, const DataStream& ssExtra, const UniValue& json)
+{
+    std::vector<unsigned char> bitmap((vecFound.size() + 7) / 8);
+    for (size_t i = 0; i < vecFound.size(); ++i) {
+        bitmap[i / 8] |= uint8_t{vecFound[i]} << (i % 8);
+    }
+    switch (rf) {
+    case RESTResponseFormat::BINARY:
+    case RESTResponseFormat::HEX: {
+        DataStream ss{};
+        ss << bitmap;
+        ss.write(ssExtra);
+        if (rf == RESTResponseFormat::HEX) {
+            req->WriteHeader("Content-Type", "text/plain");
+            req->WriteReply(HTTP_OK, HexStr(ss) + "\n");
+        } else {
+            req->WriteHeader("Content-Type", "application/octet-stream");
+            req->WriteReply(HTTP_OK, ss.str());
+        }
+        return true;
+    }
+    case RESTResponseFormat::JSON: {
+        req->WriteHeader("Content-Type", "application/json");
+        req->WriteReply(HTTP_OK, json.write() + "\n");
+        return true;
+    }
+    default: {
+        return RESTERR(req, HTTP_NOT_FOUND, "output format not found (available: " + AvailableDataFormatsString() + ")");
+    }
+    }
+}
+
+static bool rest_nevmtxroots(const std::any& context, HTTPRequest* req, const std::string& strURIPart)
+{
+    if (!CheckWarmup(req))
+        return false;
+    std::string param;
+    const RESTResponseFormat rf = ParseDataFormat(param, strURIPart);
+    if (rf == RESTResponseFormat::UNDEF) {
+        return RESTERR(req, HTTP_NOT_FOUND, "output format not found (available: " + AvailableDataFormatsString() + ")");
+    }
+    std::vector<uint256> vecBlockHashes;
+    if (!ParseNEVMHashRequest(req, param, rf, vecBlockHashes)) {
+        return false;
+    }
+    if (!pnevmtxrootsdb) {
+        return RESTERR(req, HTTP_NOT_FOUND, "NEVM tx roots not available");
+    }
+    std::vector<std::optional<NEVMTxRoot>> vecTxRoots;
+    pnevmtxrootsdb->ReadTxRoots(vecBlockHashes, vecTxRoots);
+    std::vector<bool> vecFound(vecTxRoots.size());
+    // the roots of the blocks found, in request order
+    DataStream ssRoots{};
+    for (size_t i = 0; i < vecTxRoots.size(); ++i) {
+        vecFound[i] = vecTxRoots[i].has_value();
+        if (vecTxRoots[i]) ssRoots << *vecTxRoots[i];
+    }
+    return WriteNEVMLookupReply(req, rf, vecFound, ssRoots, rf == RESTResponseFormat::JSON ? NEVMTxRootsToJSON(vecBlockHashes, vecTxRoots) : UniValue{});
+}
+
+static bool rest_nevmmints(const std::any& context, HTTPRequest* req, const std::string& strURIPart)
+{
+    if (!CheckWarmup(req))
+        return false;
+    std::string param;
+    const RESTResponseFormat rf = ParseDataFormat(param, strURIPart);
+    if (rf == RESTResponseFormat::UNDEF) {
+        return RESTERR(req, HTTP_NOT_FOUND, "output format not found (available: " + AvailableDataFormatsString() + ")");
+    }
+    std::vector<uint256> vecTxHashes;
+    if (!ParseNEVMHashRequest(req, param, rf, vecTxHashes)) {
+        return false;
+    }
+    if (!pnevmtxmintdb) {
+        return RESTERR(req, HTTP_NOT_FOUND, "NEVM mints not available");
+    }
+    std::vector<bool> vecMinted;
+    pnevmtxmintdb->ExistsTxs(vecTxHashes, vecMinted);
+    return WriteNEVMLookupReply(req, rf, vecMinted, DataStream{}, rf == RESTResponseFormat::JSON ? NEVMMintsToJSON(vecTxHashes, vecMinted) : UniValue{});
+}
+
 static const struct {
     const char* prefix;
     bool (*handler)(const std::any& context, HTTPRequest* req, const std::string& strReq);
@@ -1034,6 +1414,12 @@ static const struct {
       {"/rest/deploymentinfo/", rest_deploymentinfo},
       {"/rest/deploymentinfo", rest_deploymentinfo},
       {"/rest/blockhashbyheight/", rest_blockhash_by_height},
+      // SYSCOIN
+      {"/rest/nevmblob/", rest_nevmblob},
+      {"/rest/nevmblobs/", rest_nevmblobs},
+      {"/rest/assetallocation/", rest_assetallocation},
+      {"/rest/nevmtxroots", rest_nevmtxroots},
+      {"/rest/nevmmints", rest_nevmmints},
 };
 
 void StartREST(const std::any& context)
@@ -2397,6 +2397,9 @@ static RPCHelpMan scantxoutset()
                         {RPCResult::Type::STR_AMOUNT, "amount", "The total amount in " + CURRENCY_UNIT + " of the unspent output"},
                         {RPCResult::Type::BOOL, "coinbase", "Whether this is a coinbase output"},
                         {RPCResult::Type::NUM, "height", "Height of the unspent transaction output"},
+                        // SYSCOIN
+                        {RPCResult::Type::NUM, "asset_guid", /*optional=*/true, "The asset carried by the unspent output"},
+                        {RPCResult::Type::STR_AMOUNT, "asset_amount", /*optional=*/true, "The asset amount of the unspent output"},
                     }},
                 }},
                 {RPCResult::Type::STR_AMOUNT, "total_amount", "The total amount of all found unspent outputs in " + CURRENCY_UNIT},
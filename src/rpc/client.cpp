@@ -314,6 +314,15 @@ static const CRPCConvertParam vRPCConvertParams[] =
     { "listnevmblobdata", 2, "options" },
     { "getnevmblobdata", 1, "getdata" },
     { "syscoincreatenevmblob", 1, "overwrite_existing" },
+    { "assetallocationverifyzdagbatch", 0, "txids" },
+    { "syscoingettxrootsbatch", 0, "blockhashes" },
+    { "syscoincheckmintbatch", 0, "nevm_txhashes" },
+    { "assetallocationbalances", 1, "asset_guid" },
+    { "assetallocationhistory", 1, "asset_guid" },
+    { "assetallocationhistory", 2, "from_height" },
+    { "assetallocationhistory", 3, "count" },
+    { "getassetstats", 0, "asset_guid" },
+    { "getassetstats", 1, "height" },
     { "protx_list_wallet", 0, "detailed" },
     { "protx_list_wallet", 1, "height" },
     { "protx_list", 1, "detailed" },
@@ -6,6 +6,8 @@
 #include <chainparams.h>
 #include <httpserver.h>
 #include <index/blockfilterindex.h>
+#include <index/assetallocationindex.h>
+#include <index/assetstatsindex.h>
 #include <index/coinstatsindex.h>
 #include <index/txindex.h>
 #include <interfaces/chain.h>
@@ -552,6 +554,13 @@ static RPCHelpMan getindexinfo()
     if (g_coin_stats_index) {
         result.pushKVs(SummaryToJSON(g_coin_stats_index->GetSummary(), index_name));
     }
+    // SYSCOIN
+    if (g_asset_allocation_index) {
+        result.pushKVs(SummaryToJSON(g_asset_allocation_index->GetSummary(), index_name));
+    }
+    if (g_asset_stats_index) {
+        result.pushKVs(SummaryToJSON(g_asset_stats_index->GetSummary(), index_name));
+    }
 
     ForEachBlockFilterIndex([&result, &index_name](const BlockFilterIndex& index) {
         result.pushKVs(SummaryToJSON(index.GetSummary(), index_name));
@@ -368,6 +368,111 @@ static RPCHelpMan quorum_hasrecsig()
 },
     };
 } 
+static UniValue SigSharesStageToJSON(const llmq::CSigSharesStageStats& stage)
+{
+    UniValue obj(UniValue::VOBJ);
+    obj.pushKV("runs", stage.nRuns);
+    obj.pushKV("items", stage.nItems);
+    obj.pushKV("total_us", stage.nTotalMicros);
+    obj.pushKV("avg_us", stage.nRuns > 0 ? stage.nTotalMicros / stage.nRuns : 0);
+    obj.pushKV("last_us", stage.nLastMicros);
+    return obj;
+}
+
+static RPCHelpMan quorum_sigsharesinfo()
+{
+    return RPCHelpMan{"quorum_sigsharesinfo",
+        "\nReturn the queue depths and per-stage timings of the signature share pipeline.\n",
+        {},
+        RPCResult{
+            RPCResult::Type::OBJ, "", "",
+            {
+                {RPCResult::Type::NUM, "verify_threads", "Threads verifying sig shares in parallel, 0 if verified on the work thread"},
+                {RPCResult::Type::NUM, "pending_incoming", "Received sig shares waiting for verification"},
+                {RPCResult::Type::NUM, "pending_signs", "Local signing requests waiting to be signed"},
+                {RPCResult::Type::OBJ_DYN, "stages", "Timings of the verify, process (includes recovery), sign and send stages since startup",
+                {
+                    {RPCResult::Type::OBJ, "stage", "",
+                    {
+                        {RPCResult::Type::NUM, "runs", "Times the stage ran"},
+                        {RPCResult::Type::NUM, "items", "Sig shares handled, or send rounds for the send stage"},
+                        {RPCResult::Type::NUM, "total_us", "Total time spent in microseconds"},
+                        {RPCResult::Type::NUM, "avg_us", "Average time per run in microseconds"},
+                        {RPCResult::Type::NUM, "last_us", "Time of the last run in microseconds"},
+                    }},
+                }},
+            }},
+        RPCExamples{
+                HelpExampleCli("quorum_sigsharesinfo", "")
+            + HelpExampleRpc("quorum_sigsharesinfo", "")
+        },
+    [&](const RPCHelpMan& self, const node::JSONRPCRequest& request) -> UniValue
+{
+    if (!llmq::quorumSigSharesManager) {
+        throw JSONRPCError(RPC_INTERNAL_ERROR, "Sig shares manager not available");
+    }
+    const llmq::CSigSharesPipelineStats stats = llmq::quorumSigSharesManager->GetPipelineStats();
+    UniValue ret(UniValue::VOBJ);
+    ret.pushKV("verify_threads", stats.nVerifyThreads);
+    ret.pushKV("pending_incoming", stats.nPendingIncoming);
+    ret.pushKV("pending_signs", stats.nPendingSigns);
+    UniValue stages(UniValue::VOBJ);
+    stages.pushKV("verify", SigSharesStageToJSON(stats.verify));
+    stages.pushKV("process", SigSharesStageToJSON(stats.process));
+    stages.pushKV("sign", SigSharesStageToJSON(stats.sign));
+    stages.pushKV("send", SigSharesStageToJSON(stats.send));
+    ret.pushKV("stages", stages);
+    return ret;
+},
+    };
+}
+
+static UniValue RecSigCacheCounterToJSON(const llmq::CRecoveredSigsCacheStats::Counter& counter)
+{
+    UniValue obj(UniValue::VOBJ);
+    obj.pushKV("hits", counter.nHits);
+    obj.pushKV("misses", counter.nMisses);
+    const uint64_t nLookups = counter.nHits + counter.nMisses;
+    obj.pushKV("hit_rate", nLookups > 0 ? static_cast<double>(counter.nHits) / nLookups : 0.0);
+    return obj;
+}
+
+static RPCHelpMan quorum_recsigcacheinfo()
+{
+    return RPCHelpMan{"quorum_recsigcacheinfo",
+        "\nReturn the hit rates of the in-memory caches in front of the recovered signatures database.\n",
+        {},
+        RPCResult{
+            RPCResult::Type::OBJ_DYN, "", "One entry per cache: recsig_by_id, vote_for_id, has_sig_for_id, has_sig_for_session and has_sig_for_hash",
+            {
+                {RPCResult::Type::OBJ, "cache", "",
+                {
+                    {RPCResult::Type::NUM, "hits", "Lookups answered from the cache, including known-absent ids"},
+                    {RPCResult::Type::NUM, "misses", "Lookups that read the database"},
+                    {RPCResult::Type::NUM, "hit_rate", "hits / (hits + misses)"},
+                }},
+            }},
+        RPCExamples{
+                HelpExampleCli("quorum_recsigcacheinfo", "")
+            + HelpExampleRpc("quorum_recsigcacheinfo", "")
+        },
+    [&](const RPCHelpMan& self, const node::JSONRPCRequest& request) -> UniValue
+{
+    if (!llmq::quorumSigningManager) {
+        throw JSONRPCError(RPC_INTERNAL_ERROR, "Signing manager not available");
+    }
+    const llmq::CRecoveredSigsCacheStats stats = llmq::quorumSigningManager->GetRecoveredSigsCacheStats();
+    UniValue ret(UniValue::VOBJ);
+    ret.pushKV("recsig_by_id", RecSigCacheCounterToJSON(stats.recSigById));
+    ret.pushKV("vote_for_id", RecSigCacheCounterToJSON(stats.voteForId));
+    ret.pushKV("has_sig_for_id", RecSigCacheCounterToJSON(stats.hasSigForId));
+    ret.pushKV("has_sig_for_session", RecSigCacheCounterToJSON(stats.hasSigForSession));
+    ret.pushKV("has_sig_for_hash", RecSigCacheCounterToJSON(stats.hasSigForHash));
+    return ret;
+},
+    };
+}
+
 static bool VerifyRecoveredSigLatestQuorums(const Consensus::LLMQParams& llmq_params, ChainstateManager& chainman,
     int signHeight, const uint256& id, const uint256& msgHash, const CBLSSignature& sig)
 {
@@ -832,6 +937,8 @@ void RegisterQuorumsRPCCommands(CRPCTable &t)
         {"evo", &quorum_verify},
         {"evo", &quorum_getrecsig},
         {"evo", &quorum_isconflicting},
+        {"evo", &quorum_recsigcacheinfo},
+        {"evo", &quorum_sigsharesinfo},
         {"evo", &quorum_sign},
         {"evo", &submitchainlock},
         {"evo", &verifychainlock},
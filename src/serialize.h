@@ -649,6 +649,137 @@ void ReadAutoBitSet(Stream& s, autobitset_t& item)
     }
 }
 
+/**
+ * Stores a fixed size bitset as alternating runs of unset and set bits, starting with a run of unset bits that may be
+ * empty. Each run length is a VarInt and the runs add up to the size of the bitset.
+ */
+template<typename Stream>
+void WriteRunLengthBitSet(Stream& s, const std::vector<bool>& vec)
+{
+    bool cur = false;
+    uint32_t run = 0;
+    for (const bool bit : vec) {
+        if (bit == cur) {
+            run++;
+            continue;
+        }
+        WriteVarInt<Stream, VarIntMode::DEFAULT, uint32_t>(s, run);
+        cur = bit;
+        run = 1;
+    }
+    if (run != 0) {
+        WriteVarInt<Stream, VarIntMode::DEFAULT, uint32_t>(s, run);
+    }
+}
+
+template<typename Stream>
+void ReadRunLengthBitSet(Stream& s, std::vector<bool>& vec, size_t size)
+{
+    vec.assign(size, false);
+
+    size_t pos = 0;
+    bool cur = false;
+    while (pos < size) {
+        uint32_t run = ReadVarInt<Stream, VarIntMode::DEFAULT, uint32_t>(s);
+        // only the leading run of unset bits may be empty, so the loop always advances
+        if (run == 0 && (cur || pos != 0)) {
+            throw std::ios_base::failure("empty run");
+        }
+        if (run > size - pos) {
+            throw std::ios_base::failure("out of bounds run");
+        }
+        if (cur) {
+            std::fill(vec.begin() + pos, vec.begin() + pos + run, true);
+        }
+        pos += run;
+        cur = !cur;
+    }
+}
+
+inline size_t GetSizeOfRunLengthBitSet(const std::vector<bool>& vec)
+{
+    size_t nSize = 0;
+    bool cur = false;
+    uint32_t run = 0;
+    for (const bool bit : vec) {
+        if (bit == cur) {
+            run++;
+            continue;
+        }
+        nSize += GetSizeOfVarInt<VarIntMode::DEFAULT, uint32_t>(run);
+        cur = bit;
+        run = 1;
+    }
+    if (run != 0) {
+        nSize += GetSizeOfVarInt<VarIntMode::DEFAULT, uint32_t>(run);
+    }
+    return nSize;
+}
+
+inline size_t GetSizeOfFixedVarIntsBitSet(const std::vector<bool>& vec)
+{
+    size_t nSize = 1; // stopper
+    int32_t last = -1;
+    for (int32_t i = 0; i < (int32_t)vec.size(); i++) {
+        if (vec[i]) {
+            nSize += GetSizeOfVarInt<VarIntMode::DEFAULT, uint32_t>((uint32_t)(i - last));
+            last = i;
+        }
+    }
+    return nSize;
+}
+
+/**
+ * Like the auto bitset, but may also pick the run length form. Mostly set or clustered bitsets, as seen in the
+ * sig share invs of large quorums, are much smaller that way
+ */
+template<typename Stream>
+void WriteCompactBitSet(Stream& s, const autobitset_t& item)
+{
+    auto& vec = item.first;
+    auto& size = item.second;
+
+    assert(vec.size() == size);
+
+    size_t size1 = GetSizeOfFixedBitSet(size);
+    size_t size2 = GetSizeOfFixedVarIntsBitSet(vec);
+    size_t size3 = GetSizeOfRunLengthBitSet(vec);
+
+    if (size1 < size2 && size1 <= size3) {
+        ser_writedata8(s, 0);
+        WriteFixedBitSet(s, vec, vec.size());
+    } else if (size2 <= size3) {
+        ser_writedata8(s, 1);
+        WriteFixedVarIntsBitSet(s, vec, vec.size());
+    } else {
+        ser_writedata8(s, 2);
+        WriteRunLengthBitSet(s, vec);
+    }
+}
+
+template<typename Stream>
+void ReadCompactBitSet(Stream& s, autobitset_t& item)
+{
+    uint8_t type = ser_readdata8(s);
+
+    auto& vec = item.first;
+    auto& size = item.second;
+
+    switch (type) {
+    case 0:
+        ReadFixedBitSet(s, vec, size);
+        break;
+    case 1:
+        ReadFixedVarIntsBitSet(s, vec, size);
+        break;
+    case 2:
+        ReadRunLengthBitSet(s, vec, size);
+        break;
+    default:
+        throw std::ios_base::failure("invalid value for bitset type byte");
+    }
+}
+
 /** Simple wrapper class to serialize objects using a formatter; used by Using(). */
 template<typename Formatter, typename T>
 class Wrapper
@@ -683,6 +814,7 @@ static inline Wrapper<Formatter, T&> Using(T&& t) { return Wrapper<Formatter, T&
 // SYSCOIN
 #define DYNBITSET(obj) Using<DynamicBitSetFormatter>(obj)
 #define AUTOBITSET(obj) Using<AutoBitSetFormatter>(obj)
+#define COMPACTBITSET(obj) Using<CompactBitSetFormatter>(obj)
 
 /** TODO: describe DynamicBitSet */
 struct DynamicBitSetFormatter
@@ -719,6 +851,24 @@ struct AutoBitSetFormatter
     }
 };
 
+/**
+ * Serializes as a fixed, VarInts or run length bitset, depending on which would give the smallest size
+ */
+struct CompactBitSetFormatter
+{
+    template<typename Stream>
+    void Ser(Stream& s, const autobitset_t& item) const
+    {
+        WriteCompactBitSet(s, item);
+    }
+
+    template<typename Stream>
+    void Unser(Stream& s, autobitset_t& item)
+    {
+        ReadCompactBitSet(s, item);
+    }
+};
+
 /** Serialization wrapper class for integers in VarInt format. */
 template<VarIntMode Mode>
 struct VarIntFormatter
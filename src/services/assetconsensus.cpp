@@ -16,8 +16,19 @@
 #include <key_io.h>
 #include <logging.h>
 #include <core_io.h>
+#include <crypto/sha256.h>
+#include <crypto/siphash.h>
+#include <cuckoocache.h>
+#include <random.h>
+#include <util/hasher.h>
+#include <util/fastrange.h>
+#include <memusage.h>
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <shared_mutex>
 #include <unordered_set>
 
 std::unique_ptr<CNEVMTxRootsDB> pnevmtxrootsdb;
@@ -127,6 +138,202 @@ static bool ReadABIUint64(
     return true;
 }
 
+static dev::bytesConstRef GetMintTxValue(const CMintSyscoin &mintSyscoin) {
+    return dev::bytesConstRef(
+        mintSyscoin.vchTxParentNodes.data() + mintSyscoin.posTx,
+        mintSyscoin.vchTxParentNodes.size() - mintSyscoin.posTx
+    );
+}
+static dev::bytesConstRef GetMintReceiptValue(const CMintSyscoin &mintSyscoin) {
+    return dev::bytesConstRef(
+        mintSyscoin.vchReceiptParentNodes.data() + mintSyscoin.posReceipt,
+        mintSyscoin.vchReceiptParentNodes.size() - mintSyscoin.posReceipt
+    );
+}
+static const std::vector<unsigned char>& GetMintVaultManager(const uint32_t nHeight) {
+    const Consensus::Params& consensus = Params().GetConsensus();
+    // Inclusive cutover: below H prove legacy vault; at/above H prove V2 vault.
+    // Uses nBridgeV2StartBlock (not nCLReceiptStartBlock) so canonical receipt
+    // hardening can remain active while V2 is still undeployed.
+    return nHeight < (uint32_t)consensus.nBridgeV2StartBlock
+            ? consensus.vchSyscoinVaultManagerLegacy
+            : consensus.vchSyscoinVaultManager;
+}
+/** Verify the receipt and transaction Merkle-Patricia proofs of a mint against its roots */
+static bool CheckMintProofs(const CMintSyscoin &mintSyscoin, const bool fBridgeCanonicalActive,
+                            std::optional<uint8_t> &txEnvelopeType, std::string &strError) {
+    // the roots are 32 byte RLP strings, encode them on the stack
+    std::array<uint8_t, 33> vchTxRoot{0xa0}, vchReceiptRoot{0xa0};
+    std::copy(mintSyscoin.nTxRoot.begin(), mintSyscoin.nTxRoot.end(), vchTxRoot.begin() + 1);
+    std::copy(mintSyscoin.nReceiptRoot.begin(), mintSyscoin.nReceiptRoot.end(), vchReceiptRoot.begin() + 1);
+    const dev::RLP rlpTxRoot(dev::bytesConstRef(vchTxRoot.data(), vchTxRoot.size()));
+    const dev::RLP rlpReceiptRoot(dev::bytesConstRef(vchReceiptRoot.data(), vchReceiptRoot.size()));
+    const dev::RLP rlpTxParentNodes(&mintSyscoin.vchTxParentNodes);
+    const dev::RLP rlpReceiptParentNodes(&mintSyscoin.vchReceiptParentNodes);
+    const dev::RLP rlpTxValue(GetMintTxValue(mintSyscoin));
+    const dev::RLP rlpReceiptValue(GetMintReceiptValue(mintSyscoin));
+    const dev::bytesConstRef vchTxPathRef(mintSyscoin.vchTxPath.data(), mintSyscoin.vchTxPath.size());
+
+    std::optional<uint8_t> receiptEnvelopeType;
+    if (!VerifyProof(vchTxPathRef, rlpReceiptValue, rlpReceiptParentNodes,
+                     rlpReceiptRoot, &receiptEnvelopeType)) {
+        strError = "mint-verify-receipt-proof";
+        return false;
+    }
+    if (!VerifyProof(vchTxPathRef, rlpTxValue, rlpTxParentNodes,
+                     rlpTxRoot, &txEnvelopeType)) {
+        strError = "mint-verify-tx-proof";
+        return false;
+    }
+    // Before activation, type 0x7f failed proof matching under the historical
+    // exclusive-bound parser. Preserve that rejection while using the correct
+    // inclusive EIP-2718 decoder.
+    if (!fBridgeCanonicalActive &&
+        ((receiptEnvelopeType.has_value() && *receiptEnvelopeType == 0x7f) ||
+         (txEnvelopeType.has_value() && *txEnvelopeType == 0x7f))) {
+        strError = "mint-unsupported-tx-format";
+        return false;
+    }
+    if (fBridgeCanonicalActive && receiptEnvelopeType != txEnvelopeType) {
+        strError = "mint-envelope-type-mismatch";
+        return false;
+    }
+    return true;
+}
+/** Check the proven NEVM transaction calls the vault manager selected by height on the Syscoin NEVM chain */
+static bool CheckMintTxFormat(const CMintSyscoin &mintSyscoin, const bool fBridgeCanonicalActive, const uint32_t nHeight,
+                              const std::optional<uint8_t> &txEnvelopeType, std::string &strError) {
+    const dev::RLP rlpTxValue(GetMintTxValue(mintSyscoin));
+    const std::vector<unsigned char>& vchManagerAddress = GetMintVaultManager(nHeight);
+    if (!rlpTxValue.isList()) {
+        strError = "mint-tx-rlp-list";
+        return false;
+    }
+    const size_t txItemCount = rlpTxValue.itemCount();
+    if (txItemCount < 8) {
+        strError = "mint-tx-itemcount";
+        return false;
+    }
+
+    dev::u256 nChainID = 0;
+    size_t toFieldIndex;
+    if (fBridgeCanonicalActive) {
+        if (!txEnvelopeType.has_value()) {
+            if (txItemCount != 9) {
+                strError = "mint-invalid-legacy-tx-format";
+                return false;
+            }
+            const dev::u256 v = rlpTxValue[6].toInt<dev::u256>(dev::RLP::VeryStrict);
+            if (v >= 35) {
+                nChainID = (v - 35) / 2;
+            }
+            toFieldIndex = 3;
+        } else if (*txEnvelopeType == 1 && txItemCount == 11) {
+            nChainID = rlpTxValue[0].toInt<dev::u256>(dev::RLP::VeryStrict);
+            toFieldIndex = 4;
+        } else if (*txEnvelopeType == 2 && txItemCount == 12) {
+            nChainID = rlpTxValue[0].toInt<dev::u256>(dev::RLP::VeryStrict);
+            toFieldIndex = 5;
+        } else {
+            strError = "mint-unsupported-tx-format";
+            return false;
+        }
+    } else if (txItemCount == 9) {
+        const dev::u256 v = rlpTxValue[6].toInt<dev::u256>(dev::RLP::VeryStrict);
+        if (v >= 35) {
+            nChainID = (v - 35) / 2;
+        }
+        toFieldIndex = 3;
+    } else if (txItemCount >= 12) {
+        nChainID = rlpTxValue[0].toInt<dev::u256>(dev::RLP::VeryStrict);
+        toFieldIndex = 5;
+    } else {
+        strError = "mint-unsupported-tx-format";
+        return false;
+    }
+    
+    // Compare extracted chain ID with Syscoin's expected Chain ID
+    if(nChainID != (dev::u256(Params().GetConsensus().nNEVMChainID))) {
+        strError = "mint-invalid-chainid";
+        return false;
+    }
+    dev::bytes vchAddress = rlpTxValue[toFieldIndex].toBytes(dev::RLP::VeryStrict);
+    if (vchAddress.size() != 20) {
+        strError = "mint-invalid-address-length";
+        return false;
+    }
+    const dev::Address address160(vchAddress);
+    // Verify "to" address matches the height-selected vault manager.
+    if (vchManagerAddress != address160.asBytes()) {
+        strError = "mint-invalid-contract-manager";
+        return false;
+    }
+    
+    return true;
+}
+CMintProofCache::CMintProofCache()
+{
+    uint256 nonce = GetRandHash();
+    static constexpr unsigned char PADDING_MINT[32] = {'M'};
+    m_salted_hasher.Write(nonce.begin(), 32);
+    m_salted_hasher.Write(PADDING_MINT, 32);
+}
+
+uint256 CMintProofCache::ComputeEntry(const CMintSyscoin& mintSyscoin, const bool fBridgeCanonicalActive, const uint32_t nHeight) const
+{
+    // the roots and tx hash alone do not pin the proof nodes, those decide the outcome as well
+    CSHA256 hasher = m_salted_hasher;
+    const auto write_vector = [&hasher](const std::vector<unsigned char>& vch) {
+        unsigned char size[4];
+        WriteLE32(size, vch.size());
+        hasher.Write(size, sizeof(size)).Write(vch.data(), vch.size());
+    };
+    unsigned char header[5];
+    WriteLE16(header, mintSyscoin.posTx);
+    WriteLE16(header + 2, mintSyscoin.posReceipt);
+    header[4] = fBridgeCanonicalActive ? 1 : 0;
+    hasher.Write(mintSyscoin.nTxHash.begin(), 32).Write(mintSyscoin.nTxRoot.begin(), 32).Write(mintSyscoin.nReceiptRoot.begin(), 32);
+    hasher.Write(header, sizeof(header));
+    write_vector(mintSyscoin.vchTxPath);
+    write_vector(mintSyscoin.vchTxParentNodes);
+    write_vector(mintSyscoin.vchReceiptParentNodes);
+    write_vector(GetMintVaultManager(nHeight));
+    uint256 entry;
+    hasher.Finalize(entry.begin());
+    return entry;
+}
+
+bool CMintProofCache::Get(const uint256& entry, const bool erase)
+{
+    std::shared_lock<std::shared_mutex> lock(cs_proofcache);
+    return setValid.contains(entry, erase);
+}
+
+void CMintProofCache::Set(const uint256& entry)
+{
+    std::unique_lock<std::shared_mutex> lock(cs_proofcache);
+    setValid.insert(entry);
+}
+
+std::optional<std::pair<uint32_t, size_t>> CMintProofCache::setup_bytes(size_t n)
+{
+    return setValid.setup_bytes(n);
+}
+
+namespace {
+static CMintProofCache mintProofCache;
+} // namespace
+
+bool InitMintProofCache(size_t max_size_bytes)
+{
+    auto setup_results = mintProofCache.setup_bytes(max_size_bytes);
+    if (!setup_results) return false;
+
+    const auto [num_elems, approx_size_bytes] = *setup_results;
+    LogPrintf("Using %zu KiB out of %zu KiB requested for mint proof cache, able to store %zu elements\n",
+              approx_size_bytes >> 10, max_size_bytes >> 10, num_elems);
+    return true;
+}
 bool CheckSyscoinMintInternal(
     const CMintSyscoin &mintSyscoin,
     TxValidationState &state,
@@ -136,7 +343,8 @@ bool CheckSyscoinMintInternal(
     NEVMMintTxSet &setMintTxs,
     uint64_t &nAssetFromLog,
     CAmount &outputAmount,
-    std::string &witnessAddress) {
+    std::string &witnessAddress,
+    const bool fDeferProofs) {
     NEVMTxRoot txRootDB;
     if (!pnevmtxrootsdb || !pnevmtxrootsdb->ReadTxRoots(mintSyscoin.nBlockHash, txRootDB)) {
         return FormatSyscoinErrorMessage(state, "mint-txroot-missing", fJustCheck);
@@ -154,25 +362,8 @@ bool CheckSyscoinMintInternal(
         return FormatSyscoinErrorMessage(state, "mint-invalid-receipt-position", fJustCheck);
     }
 
-    dev::RLPStream sTxRoot, sReceiptRoot;
-    sTxRoot.append(dev::bytesConstRef(mintSyscoin.nTxRoot.data(), mintSyscoin.nTxRoot.size()));
-    sReceiptRoot.append(dev::bytesConstRef(mintSyscoin.nReceiptRoot.data(), mintSyscoin.nReceiptRoot.size()));
-    const dev::RLP rlpTxRoot(sTxRoot.out());
-    const dev::RLP rlpReceiptRoot(sReceiptRoot.out());
-    const dev::RLP rlpTxParentNodes(&mintSyscoin.vchTxParentNodes);
-    const dev::RLP rlpReceiptParentNodes(&mintSyscoin.vchReceiptParentNodes);
-    const dev::bytesConstRef vchTxValueRef(
-        mintSyscoin.vchTxParentNodes.data() + mintSyscoin.posTx,
-        mintSyscoin.vchTxParentNodes.size() - mintSyscoin.posTx
-    );
-    const dev::RLP rlpReceiptValue(
-        dev::bytesConstRef(
-            mintSyscoin.vchReceiptParentNodes.data() + mintSyscoin.posReceipt,
-            mintSyscoin.vchReceiptParentNodes.size() - mintSyscoin.posReceipt
-        )
-    );
-    const dev::RLP rlpTxValue(vchTxValueRef);
-    const dev::bytesConstRef vchTxPathRef(mintSyscoin.vchTxPath.data(), mintSyscoin.vchTxPath.size());
+    const dev::bytesConstRef vchTxValueRef(GetMintTxValue(mintSyscoin));
+    const dev::RLP rlpReceiptValue(GetMintReceiptValue(mintSyscoin));
 
     const dev::h256 txHash = dev::sha3(vchTxValueRef);
     std::vector<unsigned char> vchTxHash(txHash.asBytes());
@@ -186,26 +377,11 @@ bool CheckSyscoinMintInternal(
         return FormatSyscoinErrorMessage(state, "mint-exists", fJustCheck);
     }
 
-    std::optional<uint8_t> receiptEnvelopeType;
+    // block validation queues the proofs, see CMintProofCheck
     std::optional<uint8_t> txEnvelopeType;
-    if (!VerifyProof(vchTxPathRef, rlpReceiptValue, rlpReceiptParentNodes,
-                     rlpReceiptRoot, &receiptEnvelopeType)) {
-        return FormatSyscoinErrorMessage(state, "mint-verify-receipt-proof", fJustCheck);
-    }
-    if (!VerifyProof(vchTxPathRef, rlpTxValue, rlpTxParentNodes,
-                     rlpTxRoot, &txEnvelopeType)) {
-        return FormatSyscoinErrorMessage(state, "mint-verify-tx-proof", fJustCheck);
-    }
-    // Before activation, type 0x7f failed proof matching under the historical
-    // exclusive-bound parser. Preserve that rejection while using the correct
-    // inclusive EIP-2718 decoder.
-    if (!fBridgeCanonicalActive &&
-        ((receiptEnvelopeType.has_value() && *receiptEnvelopeType == 0x7f) ||
-         (txEnvelopeType.has_value() && *txEnvelopeType == 0x7f))) {
-        return FormatSyscoinErrorMessage(state, "mint-unsupported-tx-format", fJustCheck);
-    }
-    if (fBridgeCanonicalActive && receiptEnvelopeType != txEnvelopeType) {
-        return FormatSyscoinErrorMessage(state, "mint-envelope-type-mismatch", fJustCheck);
+    std::string strError;
+    if (!fDeferProofs && !CheckMintProofs(mintSyscoin, fBridgeCanonicalActive, txEnvelopeType, strError)) {
+        return FormatSyscoinErrorMessage(state, strError, fJustCheck);
     }
 
     if (!rlpReceiptValue.isList() || rlpReceiptValue.itemCount() != 4) {
@@ -221,15 +397,8 @@ bool CheckSyscoinMintInternal(
     if (!rlpLogs.isList() || itemCount < 1 || itemCount > 10) {
         return FormatSyscoinErrorMessage(state, "mint-invalid-receipt-logs-count", fJustCheck);
     }
-    const Consensus::Params& consensus = Params().GetConsensus();
-    // Inclusive cutover: below H prove legacy vault; at/above H prove V2 vault.
-    // Uses nBridgeV2StartBlock (not nCLReceiptStartBlock) so canonical receipt
-    // hardening can remain active while V2 is still undeployed.
-    const std::vector<unsigned char>& vchManagerAddress =
-        nHeight < (uint32_t)consensus.nBridgeV2StartBlock
-            ? consensus.vchSyscoinVaultManagerLegacy
-            : consensus.vchSyscoinVaultManager;
-    const std::vector<unsigned char>& vchFreezeTopic = consensus.vchTokenFreezeMethod;
+    const std::vector<unsigned char>& vchManagerAddress = GetMintVaultManager(nHeight);
+    const std::vector<unsigned char>& vchFreezeTopic = Params().GetConsensus().vchTokenFreezeMethod;
 
     for (size_t i = 0; i < itemCount; ++i) {
         nAssetFromLog = 0;
@@ -353,62 +522,26 @@ bool CheckSyscoinMintInternal(
         }
     }
     
-    if (!rlpTxValue.isList()) {
-        return FormatSyscoinErrorMessage(state, "mint-tx-rlp-list", fJustCheck);
-    }
-    const size_t txItemCount = rlpTxValue.itemCount();
-    if (txItemCount < 8) {
-        return FormatSyscoinErrorMessage(state, "mint-tx-itemcount", fJustCheck);
+    if (!fDeferProofs && !CheckMintTxFormat(mintSyscoin, fBridgeCanonicalActive, nHeight, txEnvelopeType, strError)) {
+        return FormatSyscoinErrorMessage(state, strError, fJustCheck);
     }
-
-    dev::u256 nChainID = 0;
-    size_t toFieldIndex;
-    if (fBridgeCanonicalActive) {
-        if (!txEnvelopeType.has_value()) {
-            if (txItemCount != 9) {
-                return FormatSyscoinErrorMessage(state, "mint-invalid-legacy-tx-format", fJustCheck);
-            }
-            const dev::u256 v = rlpTxValue[6].toInt<dev::u256>(dev::RLP::VeryStrict);
-            if (v >= 35) {
-                nChainID = (v - 35) / 2;
-            }
-            toFieldIndex = 3;
-        } else if (*txEnvelopeType == 1 && txItemCount == 11) {
-            nChainID = rlpTxValue[0].toInt<dev::u256>(dev::RLP::VeryStrict);
-            toFieldIndex = 4;
-        } else if (*txEnvelopeType == 2 && txItemCount == 12) {
-            nChainID = rlpTxValue[0].toInt<dev::u256>(dev::RLP::VeryStrict);
-            toFieldIndex = 5;
-        } else {
-            return FormatSyscoinErrorMessage(state, "mint-unsupported-tx-format", fJustCheck);
+    return true;
+}
+bool CMintProofCheck::operator()() const noexcept {
+    try {
+        std::optional<uint8_t> txEnvelopeType;
+        std::string strError;
+        if (!CheckMintProofs(*m_mint, m_bridge_canonical_active, txEnvelopeType, strError) ||
+            !CheckMintTxFormat(*m_mint, m_bridge_canonical_active, m_height, txEnvelopeType, strError)) {
+            LogPrint(BCLog::SYS, "CMintProofCheck: mint %s failed: %s\n", m_mint->nTxHash.GetHex(), strError);
+            return false;
         }
-    } else if (txItemCount == 9) {
-        const dev::u256 v = rlpTxValue[6].toInt<dev::u256>(dev::RLP::VeryStrict);
-        if (v >= 35) {
-            nChainID = (v - 35) / 2;
+        if (!m_cache_entry.IsNull()) {
+            mintProofCache.Set(m_cache_entry);
         }
-        toFieldIndex = 3;
-    } else if (txItemCount >= 12) {
-        nChainID = rlpTxValue[0].toInt<dev::u256>(dev::RLP::VeryStrict);
-        toFieldIndex = 5;
-    } else {
-        return FormatSyscoinErrorMessage(state, "mint-unsupported-tx-format", fJustCheck);
-    }
-    
-    // Compare extracted chain ID with Syscoin's expected Chain ID
-    if(nChainID != (dev::u256(Params().GetConsensus().nNEVMChainID))) {
-        return FormatSyscoinErrorMessage(state, "mint-invalid-chainid", fJustCheck);
-    }
-    dev::bytes vchAddress = rlpTxValue[toFieldIndex].toBytes(dev::RLP::VeryStrict);
-    if (vchAddress.size() != 20) {
-        return FormatSyscoinErrorMessage(state, "mint-invalid-address-length", fJustCheck);
-    }
-    const dev::Address address160(vchAddress);
-    // Verify "to" address matches the height-selected vault manager.
-    if (vchManagerAddress != address160.asBytes()) {
-        return FormatSyscoinErrorMessage(state, "mint-invalid-contract-manager", fJustCheck);
+    } catch (...) {
+        return false;
     }
-    
     return true;
 }
 bool CheckSyscoinMint(
@@ -419,11 +552,14 @@ bool CheckSyscoinMint(
     const bool &fJustCheck,
     NEVMMintTxSet &setMintTxs,
     CAssetsMap &mapAssetIn,
-    CAssetsMap &mapAssetOut
+    CAssetsMap &mapAssetOut,
+    std::vector<CMintProofCheck>* pvMintChecks,
+    const bool fCacheProofs
 ) {
     LogPrint(BCLog::SYS,"*** ASSET MINT blockHeight=%d tx=%s %s\n",
             nHeight, txHash.ToString(), fJustCheck ? "JUSTCHECK" : "BLOCK");
-    const CMintSyscoin mintSyscoin(tx);
+    const auto pmintSyscoin = std::make_shared<const CMintSyscoin>(tx);
+    const CMintSyscoin& mintSyscoin = *pmintSyscoin;
     if (mintSyscoin.IsNull()) {
         return FormatSyscoinErrorMessage(state, "mint-unserialize-failed", fJustCheck);
     }
@@ -432,8 +568,11 @@ bool CheckSyscoinMint(
     CAmount outputAmount;
     const bool fBridgeCanonicalActive =
         nHeight >= (uint32_t)Params().GetConsensus().nCLReceiptStartBlock;
+    // proofs verified on mempool acceptance are not checked again when the block connects
+    const uint256 proofEntry = mintProofCache.ComputeEntry(mintSyscoin, fBridgeCanonicalActive, nHeight);
+    const bool fProofsCached = mintProofCache.Get(proofEntry, !fCacheProofs);
     if(!CheckSyscoinMintInternal(mintSyscoin, state, fJustCheck, fBridgeCanonicalActive,
-                                nHeight, setMintTxs, nAssetFromLog, outputAmount, witnessAddress)) {
+                                nHeight, setMintTxs, nAssetFromLog, outputAmount, witnessAddress, fProofsCached || pvMintChecks != nullptr)) {
         return false; // state filled in by CheckSyscoinMintInternal
     }
     bool bFoundDest = false;
@@ -489,6 +628,14 @@ bool CheckSyscoinMint(
     if (outputAmount != nTotalMinted) {
         return FormatSyscoinErrorMessage(state, "mint-output-mismatch", fJustCheck);
     }
+    if (!fProofsCached) {
+        if (pvMintChecks) {
+            // the queued check stores the entry itself once the proofs verified
+            pvMintChecks->emplace_back(pmintSyscoin, nHeight, fBridgeCanonicalActive, fCacheProofs ? proofEntry : uint256());
+        } else if (fCacheProofs) {
+            mintProofCache.Set(proofEntry);
+        }
+    }
     if (!fJustCheck) {
         if (nHeight > 0) {
             LogPrint(BCLog::SYS,"CONNECTED ASSET MINT: asset=%llu tx=%s height=%d fJustCheck=%s\n",
@@ -513,7 +660,7 @@ bool DisconnectMintAsset(const CTransaction &tx, NEVMMintTxSet &setMintTxs){
     return true;
 }
 
-bool CheckSyscoinInputs(const Consensus::Params& params, const CTransaction& tx, const uint256& txHash, TxValidationState& state, const uint32_t &nHeight, const bool &fJustCheck, NEVMMintTxSet &setMintTxs, CAssetsMap& mapAssetIn, CAssetsMap& mapAssetOut) {
+bool CheckSyscoinInputs(const Consensus::Params& params, const CTransaction& tx, const uint256& txHash, TxValidationState& state, const uint32_t &nHeight, const bool &fJustCheck, NEVMMintTxSet &setMintTxs, CAssetsMap& mapAssetIn, CAssetsMap& mapAssetOut, std::vector<CMintProofCheck>* pvMintChecks, const bool fCacheProofs) {
     bool good = true;
     if(nHeight < (uint32_t)params.nNexusStartBlock)
         return !tx.HasAssets();
@@ -530,7 +677,7 @@ bool CheckSyscoinInputs(const Consensus::Params& params, const CTransaction& tx,
             }
         }
         if(IsSyscoinMintTx(tx.nVersion)) {
-            good = CheckSyscoinMint(tx, txHash, state, nHeight, fJustCheck, setMintTxs, mapAssetIn, mapAssetOut);
+            good = CheckSyscoinMint(tx, txHash, state, nHeight, fJustCheck, setMintTxs, mapAssetIn, mapAssetOut, pvMintChecks, fCacheProofs);
         }
         else if (IsAssetAllocationTx(tx.nVersion)) {
             good = CheckAssetAllocationInputs(tx, txHash, state, nHeight, fJustCheck, mapAssetIn, mapAssetOut);
@@ -645,12 +792,19 @@ void CNEVMTxRootsDB::FlushDataToCache(const NEVMTxRootMap &mapNEVMTxRoots) {
 }
 bool CNEVMTxRootsDB::FlushCacheToDisk(std::size_t CHUNK_ITEMS, bool fSync)
 {
-    LOCK(cs_cache);
-    if (mapCache.empty()) return true;
+    LOCK(cs_flush);
+    std::shared_ptr<const NEVMTxRootMap> snapshot;
+    {
+        // start a new generation, readers keep finding the old one until it is on disk
+        LOCK(cs_cache);
+        if (mapCache.empty()) return true;
+        snapshot = std::make_shared<const NEVMTxRootMap>(std::move(mapCache));
+        mapCache.clear();
+        mapFlushing = snapshot;
+    }
 
     CDBBatch batch(*this);
     std::size_t items = 0;
-    std::size_t count = 0;
     auto flush = [&]() {
         if (batch.SizeEstimate() == 0) return true;
         if (!WriteBatch(batch, fSync)) return false;
@@ -659,62 +813,292 @@ bool CNEVMTxRootsDB::FlushCacheToDisk(std::size_t CHUNK_ITEMS, bool fSync)
         return true;
     };
 
-    for (auto it = mapCache.begin(); it != mapCache.end(); ) {
-        batch.Write(it->first, it->second);
-        count++;
-        if (++items == CHUNK_ITEMS) {
-            if (!flush()) return false;
+    bool fOk = true;
+    for (const auto& entry : *snapshot) {
+        batch.Write(entry.first, entry.second);
+        if (++items == CHUNK_ITEMS && !flush()) {
+            fOk = false;
+            break;
         }
-        // entry is now durable → erase from cache
-        it = mapCache.erase(it);
     }
-    if (!flush()) return false;       // last partial chunk
+    if (fOk) fOk = flush();       // last partial chunk
+    {
+        LOCK(cs_cache);
+        if (!fOk) {
+            // keep the generation pending, roots cached since the swap are newer
+            for (const auto& entry : *snapshot) {
+                mapCache.emplace(entry.first, entry.second);
+            }
+        }
+        mapFlushing.reset();
+    }
+    if (!fOk) return false;
 
     LogPrint(BCLog::SYS,
              "Flushed NEVM-tx-roots cache, %zu items written in %zu-entry chunks\n",
-             count, CHUNK_ITEMS);
+             snapshot->size(), CHUNK_ITEMS);
     return true;
 }
 
+/**
+ * Look up vecKeys[i] for every index in vecIndexes with a single cursor, calling fn(i, fFound) with the cursor on
+ * the key when it is found. The keys are the raw hashes, so visiting them sorted moves the cursor forward only:
+ * it stays put while it already rests on or past the wanted key, steps with Next() when the wanted key may be the
+ * following entry and only seeks when it is further away.
+ */
+template <typename Fn>
+static void WalkSortedKeys(CDBIterator& cursor, const std::vector<uint256>& vecKeys, std::vector<size_t>& vecIndexes, Fn&& fn)
+{
+    std::sort(vecIndexes.begin(), vecIndexes.end(), [&](size_t a, size_t b) { return vecKeys[a] < vecKeys[b]; });
+    uint256 nKey;
+    bool fPositioned{false}, fKey{false};
+    for (const size_t i : vecIndexes) {
+        const uint256& nWanted{vecKeys[i]};
+        if (fPositioned && !cursor.Valid()) {
+            // ran off the end of the database, no later key can be stored
+            fn(i, false);
+            continue;
+        }
+        if (fKey && nKey < nWanted) {
+            cursor.Next();
+            fKey = cursor.Valid() && cursor.GetKey(nKey);
+        }
+        if (!fPositioned || (cursor.Valid() && (!fKey || nKey < nWanted))) {
+            cursor.Seek(nWanted);
+            fPositioned = true;
+            fKey = cursor.Valid() && cursor.GetKey(nKey);
+        }
+        fn(i, fKey && nKey == nWanted);
+    }
+}
 bool CNEVMTxRootsDB::ReadTxRoots(const uint256& nBlockHash, NEVMTxRoot& txRoot) {
-    LOCK(cs_cache);
-    auto it = mapCache.find(nBlockHash);
-    if (it != mapCache.end()) {
-        txRoot = it->second;
-        return true;
+    std::shared_ptr<const NEVMTxRootMap> flushing;
+    {
+        LOCK(cs_cache);
+        auto it = mapCache.find(nBlockHash);
+        if (it != mapCache.end()) {
+            txRoot = it->second;
+            return true;
+        }
+        flushing = mapFlushing;
+    }
+    if (flushing) {
+        auto it = flushing->find(nBlockHash);
+        if (it != flushing->end()) {
+            txRoot = it->second;
+            return true;
+        }
     }
     return Read(nBlockHash, txRoot);
 } 
+void CNEVMTxRootsDB::ReadTxRoots(const std::vector<uint256>& vecBlockHashes, std::vector<std::optional<NEVMTxRoot>>& vecTxRoots) {
+    vecTxRoots.assign(vecBlockHashes.size(), std::nullopt);
+    std::vector<size_t> vecMisses;
+    std::shared_ptr<const NEVMTxRootMap> flushing;
+    {
+        LOCK(cs_cache);
+        for (size_t i = 0; i < vecBlockHashes.size(); ++i) {
+            auto it = mapCache.find(vecBlockHashes[i]);
+            if (it != mapCache.end()) {
+                vecTxRoots[i] = it->second;
+            } else {
+                vecMisses.push_back(i);
+            }
+        }
+        flushing = mapFlushing;
+    }
+    if (flushing) {
+        std::erase_if(vecMisses, [&](size_t i) {
+            auto it = flushing->find(vecBlockHashes[i]);
+            if (it == flushing->end()) return false;
+            vecTxRoots[i] = it->second;
+            return true;
+        });
+    }
+    if (vecMisses.empty()) return;
+    std::unique_ptr<CDBIterator> pcursor(NewIterator());
+    WalkSortedKeys(*pcursor, vecBlockHashes, vecMisses, [&](size_t i, bool fFound) {
+        NEVMTxRoot txRoot;
+        if (fFound && pcursor->GetValue(txRoot)) {
+            vecTxRoots[i] = txRoot;
+        }
+    });
+}
 bool CNEVMTxRootsDB::FlushErase(const std::vector<uint256> &vecBlockHashes) {
-    LOCK(cs_cache);
+    LOCK(cs_flush);
     if(vecBlockHashes.empty())
         return true;
     CDBBatch batch(*this);
     for (const auto& hash: vecBlockHashes) {
         batch.Erase(hash);
-        auto it = mapCache.find(hash);
-        if (it != mapCache.end()) {
-            mapCache.erase(hash);
+    }
+    LogPrint(BCLog::SYS, "Flushing, erasing %d nevm tx roots\n", vecBlockHashes.size());
+    // erase on disk before the cache so a concurrent read never falls through to a stale entry
+    const bool res = WriteBatch(batch, true);
+    LOCK(cs_cache);
+    for (const auto& hash: vecBlockHashes) {
+        mapCache.erase(hash);
+    }
+    return res;
+}
+CNEVMMintFilter::CNEVMMintFilter(uint64_t nCapacityIn) : nCapacity(std::max<uint64_t>(nCapacityIn, 1)) {
+    // 1% false positives: -ln(0.01)/ln(2)^2 bits and ln(2) * bits/element hash functions per element
+    static constexpr double BITS_PER_ELEMENT{9.5851};
+    nHashFuncs = 7;
+    vData.assign((static_cast<uint64_t>(std::ceil(nCapacity * BITS_PER_ELEMENT)) + 63) / 64, 0);
+    nK0 = GetRand<uint64_t>();
+    nK1 = GetRand<uint64_t>();
+}
+void CNEVMMintFilter::insert(const uint256& nTxHash) {
+    if (vData.empty()) return;
+    const uint64_t nBits = vData.size() * 64;
+    const uint64_t h1 = SipHashUint256(nK0, nK1, nTxHash);
+    const uint64_t h2 = SipHashUint256Extra(nK0, nK1, nTxHash, 1) | 1;
+    for (uint32_t i = 0; i < nHashFuncs; ++i) {
+        const uint64_t nBit = FastRange64(h1 + i * h2, nBits);
+        vData[nBit >> 6] |= uint64_t{1} << (nBit & 63);
+    }
+    ++nElements;
+}
+bool CNEVMMintFilter::contains(const uint256& nTxHash) const {
+    // an unsized filter knows nothing, every lookup has to go to disk
+    if (vData.empty()) return true;
+    const uint64_t nBits = vData.size() * 64;
+    const uint64_t h1 = SipHashUint256(nK0, nK1, nTxHash);
+    const uint64_t h2 = SipHashUint256Extra(nK0, nK1, nTxHash, 1) | 1;
+    for (uint32_t i = 0; i < nHashFuncs; ++i) {
+        const uint64_t nBit = FastRange64(h1 + i * h2, nBits);
+        if (!(vData[nBit >> 6] & (uint64_t{1} << (nBit & 63)))) return false;
+    }
+    return true;
+}
+double CNEVMMintFilter::EstimateFalsePositiveRate() const {
+    if (vData.empty()) return 1.0;
+    uint64_t nSet = 0;
+    for (const uint64_t word : vData) {
+        nSet += std::popcount(word);
+    }
+    return std::pow(static_cast<double>(nSet) / (vData.size() * 64), nHashFuncs);
+}
+size_t CNEVMMintFilter::DynamicMemoryUsage() const {
+    return memusage::DynamicUsage(vData);
+}
+static constexpr uint8_t DB_MINT_FILTER{'f'};
+CNEVMMintedTxDB::CNEVMMintedTxDB(const DBParams& params) : CDBWrapper(params) {
+    LOCK(cs_flush);
+    // m_filter stays unsized, answering "maybe" to every lookup, until LoadFilter() vouches for this one
+    std::pair<uint256, CNEVMMintFilter> stored;
+    if (Read(DB_MINT_FILTER, stored)) {
+        m_filter_best_block = stored.first;
+        m_stored_filter = std::move(stored.second);
+    }
+}
+CNEVMMintedTxDB::~CNEVMMintedTxDB() {
+    LOCK(cs_flush);
+    // without a known tip the filter could not be checked on the next start
+    if (m_best_block.IsNull() || m_filter_best_block == m_best_block) return;
+    // includes mints that never made it to disk, a superset of the database is still a valid filter
+    CNEVMMintFilter filter = WITH_LOCK(cs_cache, return m_filter);
+    if (filter.GetCapacity() == 0) return;
+    if (!Write(DB_MINT_FILTER, std::make_pair(m_best_block, filter), true)) {
+        LogPrintf("%s: could not store the NEVM mint replay filter, it is rebuilt on the next start\n", __func__);
+    }
+}
+void CNEVMMintedTxDB::LoadFilter(const uint256& hashBestBlock) {
+    LOCK(cs_flush);
+    m_best_block = hashBestBlock;
+    if (!hashBestBlock.IsNull() && m_filter_best_block == hashBestBlock && m_stored_filter.GetCapacity() > 0) {
+        LOCK(cs_cache);
+        m_filter = std::move(m_stored_filter);
+        m_stored_filter = CNEVMMintFilter();
+        for (const auto& key : mapCache) {
+            m_filter.insert(key);
+        }
+        LogPrint(BCLog::SYS, "Loaded NEVM mint replay filter for block %s, %u mints\n", hashBestBlock.ToString(), m_filter.GetElements());
+        return;
+    }
+    if (!m_filter_best_block.IsNull()) {
+        LogPrintf("Stored NEVM mint replay filter is for block %s, not the chain tip %s, rebuilding it\n", m_filter_best_block.ToString(), hashBestBlock.ToString());
+        // a stale filter must not match a later tip, such as the same block reconnected after a reorg
+        if (!Erase(DB_MINT_FILTER, true)) {
+            LogPrintf("%s: could not erase the stale NEVM mint replay filter\n", __func__);
         }
+        m_filter_best_block.SetNull();
+        m_stored_filter = CNEVMMintFilter();
     }
-    if(vecBlockHashes.size() > 0)
-        LogPrint(BCLog::SYS, "Flushing, erasing %d nevm tx roots\n", vecBlockHashes.size());
-    return WriteBatch(batch, true);
+    RebuildFilter();
+}
+void CNEVMMintedTxDB::RebuildFilter() {
+    // writers are held off by cs_flush, so the database does not change under the two passes
+    uint64_t nCount = 0;
+    {
+        std::unique_ptr<CDBIterator> pcursor(NewIterator());
+        uint256 nTxHash;
+        for (pcursor->SeekToFirst(); pcursor->Valid(); pcursor->Next()) {
+            if (pcursor->GetKey(nTxHash)) ++nCount;
+        }
+    }
+    CNEVMMintFilter filter(std::max(DEFAULT_MINT_FILTER_CAPACITY, 2 * nCount));
+    {
+        std::unique_ptr<CDBIterator> pcursor(NewIterator());
+        uint256 nTxHash;
+        for (pcursor->SeekToFirst(); pcursor->Valid(); pcursor->Next()) {
+            if (pcursor->GetKey(nTxHash)) filter.insert(nTxHash);
+        }
+    }
+    LOCK(cs_cache);
+    // mints cached while the database was walked are only in the old filter
+    for (const auto& key : mapCache) {
+        filter.insert(key);
+    }
+    m_filter = std::move(filter);
+    LogPrint(BCLog::SYS, "Rebuilt NEVM mint replay filter, %u mints on disk, capacity %u\n", nCount, m_filter.GetCapacity());
+}
+void CNEVMMintedTxDB::GetFilterStats(CNEVMMintFilterStats& stats) const {
+    {
+        LOCK(cs_cache);
+        stats.nElements = m_filter.GetElements();
+        stats.nCapacity = m_filter.GetCapacity();
+        stats.nHashFuncs = m_filter.GetHashFuncs();
+        stats.nBytes = m_filter.DynamicMemoryUsage();
+        stats.dEstimatedFPRate = m_filter.EstimateFalsePositiveRate();
+    }
+    stats.nLookups = m_filter_lookups;
+    stats.nFilteredOut = m_filter_negatives;
+    stats.nFalsePositives = m_filter_false_positives;
 }
 void CNEVMMintedTxDB::FlushDataToCache(const NEVMMintTxSet &mapNEVMTxRoots) {
     LOCK(cs_cache);
     for (auto const& key : mapNEVMTxRoots) {
-        mapCache.insert(key);
+        if (mapCache.insert(key).second) {
+            m_filter.insert(key);
+        }
     }
 }
-bool CNEVMMintedTxDB::FlushCacheToDisk(std::size_t CHUNK_ITEMS, bool fSync)
+bool CNEVMMintedTxDB::FlushCacheToDisk(std::size_t CHUNK_ITEMS, bool fSync, const uint256& hashBestBlock)
 {
-    LOCK(cs_cache);
-    if (mapCache.empty()) return true;
+    LOCK(cs_flush);
+    // any write the caller does not tie to a tip leaves the tip unknown
+    m_best_block.SetNull();
+    std::shared_ptr<const NEVMMintTxSet> snapshot;
+    {
+        LOCK(cs_cache);
+        if (mapCache.empty()) {
+            m_best_block = hashBestBlock;
+            return true;
+        }
+        snapshot = std::make_shared<const NEVMMintTxSet>(std::move(mapCache));
+        mapCache.clear();
+        mapFlushing = snapshot;
+    }
 
     CDBBatch batch(*this);
     std::size_t items = 0;
-    std::size_t count = 0;
+    if (!m_filter_best_block.IsNull()) {
+        // the stored filter does not know these mints, drop it in the same batch as the first of them
+        batch.Erase(DB_MINT_FILTER);
+        m_filter_best_block.SetNull();
+    }
 
     auto flush = [&]() {
         if (batch.SizeEstimate() == 0) return true;
@@ -724,41 +1108,104 @@ bool CNEVMMintedTxDB::FlushCacheToDisk(std::size_t CHUNK_ITEMS, bool fSync)
         return true;
     };
 
-    for (auto it = mapCache.begin(); it != mapCache.end(); ) {
-        batch.Write(*it, true);       // value is a dummy bool
-        count++;
-        if (++items == CHUNK_ITEMS) {
-            if (!flush()) return false;
+    bool fOk = true;
+    for (const auto& key : *snapshot) {
+        batch.Write(key, true);       // value is a dummy bool
+        if (++items == CHUNK_ITEMS && !flush()) {
+            fOk = false;
+            break;
+        }
+    }
+    if (fOk) fOk = flush();
+    {
+        LOCK(cs_cache);
+        if (!fOk) {
+            mapCache.insert(snapshot->begin(), snapshot->end());
         }
-        it = mapCache.erase(it);      // safe to purge now
+        mapFlushing.reset();
     }
-    if (!flush()) return false;
+    if (!fOk) return false;
 
     LogPrint(BCLog::SYS,
              "Flushed NEVM-minted-tx cache, %zu items written in %zu-entry chunks\n",
-             count, CHUNK_ITEMS);
+             snapshot->size(), CHUNK_ITEMS);
+    m_best_block = hashBestBlock;
+    if (WITH_LOCK(cs_cache, return m_filter.IsFull())) {
+        RebuildFilter();
+    }
     return true;
 }
 
 bool CNEVMMintedTxDB::FlushErase(const NEVMMintTxSet &mapNEVMTxRoots) {
-    LOCK(cs_cache);
+    LOCK(cs_flush);
     if(mapNEVMTxRoots.empty())
         return true;
+    m_best_block.SetNull();
     CDBBatch batch(*this);
     for (const auto &key : mapNEVMTxRoots) {
         batch.Erase(key);
-        auto it = mapCache.find(key);
-        if(it != mapCache.end()){
-            mapCache.erase(it);
-        }
     }
-    if(mapNEVMTxRoots.size() > 0)
-        LogPrint(BCLog::SYS, "Flushing, erasing %d nevm tx mints\n", mapNEVMTxRoots.size());
-    return WriteBatch(batch, true);
+    LogPrint(BCLog::SYS, "Flushing, erasing %d nevm tx mints\n", mapNEVMTxRoots.size());
+    const bool res = WriteBatch(batch, true);
+    LOCK(cs_cache);
+    for (const auto &key : mapNEVMTxRoots) {
+        mapCache.erase(key);
+    }
+    return res;
 }
 bool CNEVMMintedTxDB::ExistsTx(const uint256& nTxHash) {
-    LOCK(cs_cache);
-    return (mapCache.find(nTxHash) != mapCache.end()) || Exists(nTxHash);
+    std::shared_ptr<const NEVMMintTxSet> flushing;
+    {
+        LOCK(cs_cache);
+        if (mapCache.count(nTxHash)) return true;
+        ++m_filter_lookups;
+        if (!m_filter.contains(nTxHash)) {
+            ++m_filter_negatives;
+            return false;
+        }
+        flushing = mapFlushing;
+    }
+    if (flushing && flushing->count(nTxHash)) return true;
+    if (Exists(nTxHash)) return true;
+    ++m_filter_false_positives;
+    return false;
+}
+void CNEVMMintedTxDB::ExistsTxs(const std::vector<uint256>& vecTxHashes, std::vector<bool>& vecExists) {
+    vecExists.assign(vecTxHashes.size(), false);
+    std::vector<size_t> vecMisses;
+    std::shared_ptr<const NEVMMintTxSet> flushing;
+    {
+        LOCK(cs_cache);
+        for (size_t i = 0; i < vecTxHashes.size(); ++i) {
+            if (mapCache.count(vecTxHashes[i])) {
+                vecExists[i] = true;
+                continue;
+            }
+            ++m_filter_lookups;
+            if (!m_filter.contains(vecTxHashes[i])) {
+                ++m_filter_negatives;
+                continue;
+            }
+            vecMisses.push_back(i);
+        }
+        flushing = mapFlushing;
+    }
+    if (flushing) {
+        std::erase_if(vecMisses, [&](size_t i) {
+            if (!flushing->count(vecTxHashes[i])) return false;
+            vecExists[i] = true;
+            return true;
+        });
+    }
+    if (vecMisses.empty()) return;
+    std::unique_ptr<CDBIterator> pcursor(NewIterator());
+    WalkSortedKeys(*pcursor, vecTxHashes, vecMisses, [&](size_t i, bool fFound) {
+        if (fFound) {
+            vecExists[i] = true;
+        } else {
+            ++m_filter_false_positives;
+        }
+    });
 }
 std::string stringFromSyscoinTx(const int &nVersion) {
     switch (nVersion) {
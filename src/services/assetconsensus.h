@@ -7,35 +7,166 @@
 #include <primitives/transaction.h>
 #include <dbwrapper.h>
 #include <consensus/params.h>
+#include <crypto/sha256.h>
+#include <cuckoocache.h>
 #include <util/hasher.h>
 #include <sync.h>
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <vector>
 class TxValidationState;
 class CTxUndo;
 class CBlock;
+/**
+ * The tx roots and minted tx caches are read from mempool acceptance, RPC and block connection at once.
+ * cs_cache only guards the in-memory lookups and the swap of cache generations: on flush the pending
+ * generation is moved aside as an immutable snapshot that readers keep consulting while it is written
+ * out with no lock held, so a read never waits on LevelDB I/O and a key is always found either in memory
+ * or on disk. cs_flush serializes the writers (flush and erase) against each other.
+ */
+/** Upper bound on keys resolved by one batched tx root or mint lookup */
+static constexpr size_t MAX_NEVM_BATCH_LOOKUP{10000};
+
 class CNEVMTxRootsDB : public CDBWrapper {
-    NEVMTxRootMap mapCache;
+    Mutex cs_flush;
     mutable Mutex cs_cache; // Mutex to protect cache operations (non-recursive for better performance)
+    NEVMTxRootMap mapCache GUARDED_BY(cs_cache);
+    std::shared_ptr<const NEVMTxRootMap> mapFlushing GUARDED_BY(cs_cache);
 public:
     using CDBWrapper::CDBWrapper;
-    bool FlushErase(const std::vector<uint256> &vecBlockHashes) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
+    bool FlushErase(const std::vector<uint256> &vecBlockHashes) EXCLUSIVE_LOCKS_REQUIRED(!cs_flush, !cs_cache);
     bool ReadTxRoots(const uint256& nBlockHash, NEVMTxRoot& txRoot) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
-    bool FlushCacheToDisk(std::size_t CHUNK_ITEMS = 100000, bool fSync = true) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
+    /** Roots of several blocks, in request order, taking cs_cache once and reading misses from disk in key order */
+    void ReadTxRoots(const std::vector<uint256>& vecBlockHashes, std::vector<std::optional<NEVMTxRoot>>& vecTxRoots) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
+    bool FlushCacheToDisk(std::size_t CHUNK_ITEMS = 100000, bool fSync = true) EXCLUSIVE_LOCKS_REQUIRED(!cs_flush, !cs_cache);
     void FlushDataToCache(const NEVMTxRootMap &mapNEVMTxRoots) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
 };
 
+/** Minimum number of mints the replay filter is sized for, it is rebuilt twice as large once outgrown */
+static constexpr uint64_t DEFAULT_MINT_FILTER_CAPACITY{1 << 16};
+
+/**
+ * Bloom filter over every minted NEVM tx hash, sized for a 1% false positive rate. A new mint is never
+ * in the replay database, so a definite "absent" from the filter saves the LevelDB miss. Bits are picked
+ * by a salted SipHash double hash; the salt is persisted with the filter.
+ */
+class CNEVMMintFilter {
+    std::vector<uint64_t> vData;
+    uint64_t nK0{0};
+    uint64_t nK1{0};
+    uint32_t nHashFuncs{0};
+    uint64_t nElements{0};
+    uint64_t nCapacity{0};
+public:
+    CNEVMMintFilter() {}
+    explicit CNEVMMintFilter(uint64_t nCapacityIn);
+    void insert(const uint256& nTxHash);
+    bool contains(const uint256& nTxHash) const;
+    bool IsFull() const { return nElements > nCapacity; }
+    double EstimateFalsePositiveRate() const;
+    size_t DynamicMemoryUsage() const;
+    uint64_t GetElements() const { return nElements; }
+    uint64_t GetCapacity() const { return nCapacity; }
+    uint32_t GetHashFuncs() const { return nHashFuncs; }
+    SERIALIZE_METHODS(CNEVMMintFilter, obj) {
+        READWRITE(obj.nK0, obj.nK1, obj.nHashFuncs, VARINT(obj.nElements), VARINT(obj.nCapacity), obj.vData);
+    }
+};
+
+struct CNEVMMintFilterStats {
+    uint64_t nElements{0};
+    uint64_t nCapacity{0};
+    uint32_t nHashFuncs{0};
+    size_t nBytes{0};
+    double dEstimatedFPRate{0};
+    uint64_t nLookups{0};
+    uint64_t nFilteredOut{0};
+    uint64_t nFalsePositives{0};
+};
+
+/**
+ * The replay filter is kept on disk while nothing new has been flushed to the database since it was
+ * written (it is stored at shutdown and dropped by the next flush). It is stored with the chain tip the
+ * database was last flushed for and only used again by LoadFilter() for that same tip; otherwise, as
+ * when another build wrote to the database without dropping it, it is rebuilt.
+ */
 class CNEVMMintedTxDB : public CDBWrapper {
-    NEVMMintTxSet mapCache;
+    Mutex cs_flush;
     mutable Mutex cs_cache; // Mutex to protect cache operations (non-recursive for better performance)
+    NEVMMintTxSet mapCache GUARDED_BY(cs_cache);
+    std::shared_ptr<const NEVMMintTxSet> mapFlushing GUARDED_BY(cs_cache);
+    CNEVMMintFilter m_filter GUARDED_BY(cs_cache);
+    //! Tip of the last flush made together with the chainstate, null after any other write
+    uint256 m_best_block GUARDED_BY(cs_flush);
+    //! Tip the stored filter was written for, null while no filter is stored
+    uint256 m_filter_best_block GUARDED_BY(cs_flush);
+    //! The stored filter, until LoadFilter() checks it against the chain tip
+    CNEVMMintFilter m_stored_filter GUARDED_BY(cs_flush);
+    std::atomic<uint64_t> m_filter_lookups{0};
+    std::atomic<uint64_t> m_filter_negatives{0};
+    std::atomic<uint64_t> m_filter_false_positives{0};
+    void RebuildFilter() EXCLUSIVE_LOCKS_REQUIRED(cs_flush, !cs_cache);
 public:
-    using CDBWrapper::CDBWrapper;
-    bool FlushErase(const NEVMMintTxSet &setMintTxs) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
-    bool FlushCacheToDisk(std::size_t CHUNK_ITEMS = 256, bool fSync = true) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
+    explicit CNEVMMintedTxDB(const DBParams& params);
+    ~CNEVMMintedTxDB();
+    /** Use the stored filter if it was written for this chain tip, rebuild it otherwise. Until then every lookup reads the database */
+    void LoadFilter(const uint256& hashBestBlock) EXCLUSIVE_LOCKS_REQUIRED(!cs_flush, !cs_cache);
+    void GetFilterStats(CNEVMMintFilterStats& stats) const EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
+    bool FlushErase(const NEVMMintTxSet &setMintTxs) EXCLUSIVE_LOCKS_REQUIRED(!cs_flush, !cs_cache);
+    /** Write the cached mints, hashBestBlock is the chain tip they complete when flushed with the chainstate */
+    bool FlushCacheToDisk(std::size_t CHUNK_ITEMS = 256, bool fSync = true, const uint256& hashBestBlock = uint256()) EXCLUSIVE_LOCKS_REQUIRED(!cs_flush, !cs_cache);
     void FlushDataToCache(const NEVMMintTxSet &mapNEVMTxRoots) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
     bool ExistsTx(const uint256& nTxHash) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
+    /** ExistsTx for several hashes, in request order, taking cs_cache once and reading misses from disk in key order */
+    void ExistsTxs(const std::vector<uint256>& vecTxHashes, std::vector<bool>& vecExists) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
 };
 
 extern std::unique_ptr<CNEVMTxRootsDB> pnevmtxrootsdb;
 extern std::unique_ptr<CNEVMMintedTxDB> pnevmtxmintdb;
+/**
+ * The Merkle-Patricia proofs of a bridge mint and the checks on the proven NEVM transaction. Block
+ * validation queues these on the script check threads once the serial mint checks (tx root, replay,
+ * receipt log) have passed, so blocks with many mints verify them in parallel.
+ */
+class CMintProofCheck
+{
+private:
+    std::shared_ptr<const CMintSyscoin> m_mint;
+    uint32_t m_height{0};
+    bool m_bridge_canonical_active{false};
+    //! Mint proof cache entry stored once the proofs verify, null to store nothing
+    uint256 m_cache_entry;
+public:
+    CMintProofCheck() {}
+    CMintProofCheck(std::shared_ptr<const CMintSyscoin> mint, const uint32_t nHeight, const bool fBridgeCanonicalActive, const uint256& cacheEntry = uint256()) :
+        m_mint(std::move(mint)), m_height(nHeight), m_bridge_canonical_active(fBridgeCanonicalActive), m_cache_entry(cacheEntry) {}
+    bool operator()() const noexcept;
+};
+/**
+ * Mints whose proofs verified when they entered the mempool, so connecting the block that
+ * contains them does not walk the same Merkle-Patricia proofs again. Works like the signature
+ * cache: entries are stored on mempool acceptance and dropped once a block connects them.
+ */
+class CMintProofCache
+{
+private:
+    //! Entries are SHA256(nonce || 'M' || 31 zero bytes || every input of the proof and tx format checks)
+    CSHA256 m_salted_hasher;
+    CuckooCache::cache<uint256, SignatureCacheHasher> setValid;
+    std::shared_mutex cs_proofcache;
+
+public:
+    CMintProofCache();
+    uint256 ComputeEntry(const CMintSyscoin& mintSyscoin, const bool fBridgeCanonicalActive, const uint32_t nHeight) const;
+    bool Get(const uint256& entry, const bool erase);
+    void Set(const uint256& entry);
+    std::optional<std::pair<uint32_t, size_t>> setup_bytes(size_t n);
+};
+/** Size the cache of mints whose proofs verified, see CheckSyscoinMint */
+[[nodiscard]] bool InitMintProofCache(size_t max_size_bytes);
 bool DisconnectMintAsset(const CTransaction &tx, NEVMMintTxSet &setMintTxs);
 bool CheckSyscoinMint(const CTransaction& tx, 
     const uint256& txHash,
@@ -44,7 +175,9 @@ bool CheckSyscoinMint(const CTransaction& tx,
     const bool &fJustCheck, 
     NEVMMintTxSet &setMintTxs, 
     CAssetsMap &mapAssetIn, 
-    CAssetsMap &mapAssetOut);
+    CAssetsMap &mapAssetOut,
+    std::vector<CMintProofCheck>* pvMintChecks = nullptr,
+    const bool fCacheProofs = false);
 bool CheckSyscoinMintInternal(const CMintSyscoin &mintSyscoin,
     TxValidationState &state,
     const bool &fJustCheck,
@@ -53,7 +186,13 @@ bool CheckSyscoinMintInternal(const CMintSyscoin &mintSyscoin,
     NEVMMintTxSet &setMintTxs,
     uint64_t &nAssetFromLog,
     CAmount &outputAmount,
-    std::string &witnessAddress);
+    std::string &witnessAddress,
+    const bool fDeferProofs = false);
+/**
+ * With pvMintChecks set the mint proofs are appended there instead of being verified, see CMintProofCheck.
+ * fCacheProofs stores verified mint proofs for later, queued ones once their check passes, otherwise cached ones are
+ * used up like the script execution cache does.
+ */
 bool CheckSyscoinInputs(const Consensus::Params& params, 
     const CTransaction& tx, 
     const uint256& txHash, 
@@ -62,7 +201,9 @@ bool CheckSyscoinInputs(const Consensus::Params& params,
     const bool &fJustCheck, 
     NEVMMintTxSet &setMintTxs, 
     CAssetsMap& mapAssetIn, 
-    CAssetsMap& mapAssetOut);
+    CAssetsMap& mapAssetOut,
+    std::vector<CMintProofCheck>* pvMintChecks = nullptr,
+    const bool fCacheProofs = false);
 bool CheckAssetAllocationInputs(const CTransaction &tx, 
     const uint256& txHash, 
     TxValidationState &tstate, 
@@ -5,6 +5,7 @@
 #include <services/assetconsensus.h>
 #include <validation.h>
 #include <chainparams.h>
+#include <crypto/common.h>
 #include <consensus/validation.h>
 #include <nevm/nevm.h>
 #include <nevm/address.h>
@@ -17,6 +18,17 @@
 #include <timedata.h>
 #include <key_io.h>
 #include <logging.h>
+#include <random.h>
+#include <util/fs_helpers.h>
+
+#include <set>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 std::unique_ptr<CBlockIndexDB> pblockindexdb;
 std::unique_ptr<CNEVMDataDB> pnevmdatadb;
 std::unique_ptr<CNEVMDataBlobDB> pnevmdatablobdb;
@@ -33,12 +45,167 @@ bool DisconnectSyscoinTransaction(const CTransaction& tx, NEVMMintTxSet &setMint
     return true;       
 }
 
+static constexpr uint8_t DB_PODA_STATS{'s'};
+static constexpr uint8_t DB_PODA_TIME{'t'};
+
+/** Secondary key ordering PoDA metadata by median time, so pruning only walks the expired range */
+struct CNEVMDataTimeKey {
+    uint64_t nMedianTime{0};
+    std::vector<uint8_t> vchVersionHash;
+    CNEVMDataTimeKey() {}
+    CNEVMDataTimeKey(const int64_t nMedianTimeIn, const std::vector<uint8_t>& vchVersionHashIn): nMedianTime(std::max<int64_t>(nMedianTimeIn, 0)), vchVersionHash(vchVersionHashIn) {}
+    SERIALIZE_METHODS(CNEVMDataTimeKey, obj) {
+        READWRITE(Using<BigEndianFormatter<8>>(obj.nMedianTime), obj.vchVersionHash);
+    }
+};
+
+CNEVMDataDB::CNEVMDataDB(const DBParams& params) : CDBWrapper(params) {
+    LOCK(cs_cache);
+    Read(DB_PODA_STATS, m_stats);
+}
+
+bool CNEVMDataDB::Upgrade() {
+    LOCK(cs_cache);
+    if(Exists(DB_PODA_STATS)) {
+        return true;
+    }
+    // databases written before the time index existed carry only the version hash keys, build the index and totals once
+    LogPrintf("Building NEVM data time index...\n");
+    static constexpr size_t MAX_INDEX_BATCH_BYTES{16 << 20};
+    CNEVMDataStats stats;
+    CDBBatch batch(*this);
+    std::unique_ptr<CDBIterator> pcursor(NewIterator());
+    pcursor->SeekToFirst();
+    std::vector<uint8_t> vchVersionHash;
+    MapPoDAPayloadMeta meta;
+    while (pcursor->Valid()) {
+        if (pcursor->GetKey(vchVersionHash) && pcursor->GetValue(meta)) {
+            batch.Write(std::make_pair(DB_PODA_TIME, CNEVMDataTimeKey(meta.nMedianTime, vchVersionHash)), meta.nSize);
+            stats.nBlobs++;
+            stats.nSize += meta.nSize;
+            if (batch.SizeEstimate() > MAX_INDEX_BATCH_BYTES) {
+                if (!WriteBatch(batch)) {
+                    return error("%s: failed to write nevm data time index", __func__);
+                }
+                batch.Clear();
+            }
+        }
+        pcursor->Next();
+    }
+    batch.Write(DB_PODA_STATS, stats);
+    if (!WriteBatch(batch, true)) {
+        return error("%s: failed to write nevm data time index", __func__);
+    }
+    m_stats = stats;
+    LogPrintf("Indexed %d NEVM blobs (%d bytes)\n", m_stats.nBlobs, m_stats.nSize);
+    return true;
+}
+
+void CNEVMDataDB::WriteMetaToBatch(CDBBatch& batch, const std::vector<uint8_t>& vchVersionHash, const MapPoDAPayloadMeta& meta) {
+    AssertLockHeld(cs_cache);
+    // an existing entry may be refreshed with a newer median time, move its index entry along with it
+    EraseMetaToBatch(batch, vchVersionHash);
+    batch.Write(vchVersionHash, meta);
+    batch.Write(std::make_pair(DB_PODA_TIME, CNEVMDataTimeKey(meta.nMedianTime, vchVersionHash)), meta.nSize);
+    m_stats.nBlobs++;
+    m_stats.nSize += meta.nSize;
+}
+
+bool CNEVMDataDB::EraseMetaToBatch(CDBBatch& batch, const std::vector<uint8_t>& vchVersionHash) {
+    AssertLockHeld(cs_cache);
+    MapPoDAPayloadMeta meta;
+    if (!Read(vchVersionHash, meta)) {
+        return false;
+    }
+    batch.Erase(vchVersionHash);
+    batch.Erase(std::make_pair(DB_PODA_TIME, CNEVMDataTimeKey(meta.nMedianTime, vchVersionHash)));
+    m_stats.nBlobs -= std::min<uint64_t>(m_stats.nBlobs, 1);
+    m_stats.nSize -= std::min<uint64_t>(m_stats.nSize, meta.nSize);
+    return true;
+}
+
+bool CNEVMDataDB::WriteIndexedBatch(CDBBatch& batch, bool fSync) {
+    AssertLockHeld(cs_cache);
+    batch.Write(DB_PODA_STATS, m_stats);
+    if (!WriteBatch(batch, fSync)) {
+        // keep the in-memory totals in line with what actually reached disk
+        m_stats = CNEVMDataStats{};
+        Read(DB_PODA_STATS, m_stats);
+        return false;
+    }
+    return true;
+}
+
+void CNEVMDataDB::CacheMeta(const std::vector<uint8_t>& vchVersionHash, const MapPoDAPayloadMeta& meta, bool fOnDisk) {
+    AssertLockHeld(cs_cache);
+    auto [it, inserted] = mapCache.try_emplace(vchVersionHash, meta);
+    if (inserted) {
+        // a refresh keeps the size already on disk so only new entries move the totals
+        if (!fOnDisk) {
+            m_cacheStats.nBlobs++;
+            m_cacheStats.nSize += meta.nSize;
+        }
+    } else {
+        m_cacheTimes.erase(m_cacheTimes.find(it->second.nMedianTime));
+        it->second.nMedianTime = meta.nMedianTime;
+        it->second.txid = meta.txid;
+    }
+    m_cacheTimes.insert(meta.nMedianTime);
+}
+
+PoDAMAPMemory::iterator CNEVMDataDB::UncacheMeta(PoDAMAPMemory::iterator it, bool fOnDisk) {
+    AssertLockHeld(cs_cache);
+    if (!fOnDisk) {
+        m_cacheStats.nBlobs -= std::min<uint64_t>(m_cacheStats.nBlobs, 1);
+        m_cacheStats.nSize -= std::min<uint64_t>(m_cacheStats.nSize, it->second.nSize);
+    }
+    m_cacheTimes.erase(m_cacheTimes.find(it->second.nMedianTime));
+    return mapCache.erase(it);
+}
+
+void CNEVMDataDB::ClearCache() {
+    AssertLockHeld(cs_cache);
+    mapCache.clear();
+    m_cacheStats = CNEVMDataStats{};
+    m_cacheTimes.clear();
+}
+
+void CNEVMDataDB::GetStats(CNEVMDataStats& stats, int64_t& nOldest, int64_t& nNewest) {
+    AssertLockHeld(cs_cache);
+    stats.nBlobs = m_stats.nBlobs + m_cacheStats.nBlobs;
+    stats.nSize = m_stats.nSize + m_cacheStats.nSize;
+    nOldest = std::numeric_limits<int64_t>::max();
+    nNewest = 0;
+    std::pair<uint8_t, CNEVMDataTimeKey> key;
+    std::unique_ptr<CDBIterator> pcursor(NewIterator());
+    pcursor->Seek(std::make_pair(DB_PODA_TIME, CNEVMDataTimeKey()));
+    if (pcursor->Valid() && pcursor->GetKey(key) && key.first == DB_PODA_TIME) {
+        nOldest = key.second.nMedianTime;
+    }
+    pcursor->Seek(static_cast<uint8_t>(DB_PODA_TIME + 1));
+    if (pcursor->Valid()) {
+        pcursor->Prev();
+    } else {
+        pcursor->SeekToLast();
+    }
+    if (pcursor->Valid() && pcursor->GetKey(key) && key.first == DB_PODA_TIME) {
+        nNewest = key.second.nMedianTime;
+    }
+    if (!m_cacheTimes.empty()) {
+        nOldest = std::min(nOldest, *m_cacheTimes.begin());
+        nNewest = std::max(nNewest, *m_cacheTimes.rbegin());
+    }
+    if (nOldest == std::numeric_limits<int64_t>::max()) {
+        nOldest = 0;
+    }
+}
+
 void CNEVMDataDB::FlushDataToCache(const PoDAMAPMemory &mapPoDA, PoDAFlushSource source) {
     LOCK(cs_cache);
     if(mapPoDA.empty()) {
         return;
     }
-    CDBBatch batchblob(*pnevmdatablobdb);  
+    PoDAMAPMemory mapBlobs;
     for (auto const& [key, val] : mapPoDA) {
         if(!val.vchNEVMData) {
             continue;
@@ -46,28 +213,22 @@ void CNEVMDataDB::FlushDataToCache(const PoDAMAPMemory &mapPoDA, PoDAFlushSource
         MapPoDAPayloadMeta meta;
         if(Read(key, meta)) {
             if(source == PoDAFlushSource::Block && meta.nSize == val.nSize) {
-                auto inserted = mapCache.try_emplace(key, val.txid, meta.nSize, val.nMedianTime);
-                if(!inserted.second) {
-                    inserted.first->second.nMedianTime = val.nMedianTime;
-                    inserted.first->second.txid = val.txid;
-                }
+                CacheMeta(key, MapPoDAPayloadMeta{val.txid, meta.nSize, val.nMedianTime}, /*fOnDisk=*/true);
             }
             continue;
         }
-        auto inserted = mapCache.try_emplace(key, val.txid, val.nSize, val.nMedianTime);
-        if(!inserted.second) {
-            if(source == PoDAFlushSource::Block && inserted.first->second.nSize == val.nSize) {
-                inserted.first->second.nMedianTime = val.nMedianTime;
-                inserted.first->second.txid = val.txid;
+        auto it = mapCache.find(key);
+        if(it != mapCache.end()) {
+            if(source == PoDAFlushSource::Block && it->second.nSize == val.nSize) {
+                CacheMeta(key, MapPoDAPayloadMeta{val.txid, val.nSize, val.nMedianTime}, /*fOnDisk=*/false);
             }
             continue;
         }
-        if(!pnevmdatablobdb->Exists(key)) {
-            batchblob.Write(key, val.vchNEVMData);
-        }
+        CacheMeta(key, MapPoDAPayloadMeta{val.txid, val.nSize, val.nMedianTime}, /*fOnDisk=*/false);
+        mapBlobs.emplace(key, val);
     }
-    if(batchblob.SizeEstimate() > 0) {
-        pnevmdatablobdb->WriteBatch(batchblob);
+    if(!mapBlobs.empty() && !pnevmdatablobdb->WriteBlobs(mapBlobs)) {
+        LogPrintf("FlushDataToCache: could not store %d nevm blobs\n", mapBlobs.size());
     }
 }
 bool CNEVMDataDB::FlushCacheToDisk(const int64_t nMedianTime, bool fSync) {
@@ -85,22 +246,22 @@ bool CNEVMDataDB::FlushCacheToDisk(const int64_t nMedianTime, bool fSync) {
     LOCK(cs_cache);
     CDBBatch batch(*this);
     // only prune on testnet flush, mainnet relies only on CL
+    NEVMDataVec vecBlobKeys;
     if(fTestNet) {
-        CDBBatch batchblob(*pnevmdatablobdb);
-        if (!PruneToBatch(batch, batchblob, nMedianTime)) {
+        if (!PruneToBatch(batch, vecBlobKeys, nMedianTime)) {
             LogPrint(BCLog::SYS, "Error: Could not prune nevm blobs\n");
             return false;
         }
-        pnevmdatablobdb->WriteBatch(batchblob);
     }
     for (auto const& [key, val] : mapCache) {
-        batch.Write(key, val);
+        WriteMetaToBatch(batch, key, val);
     }
     if(mapCache.size() > 0)
         LogPrint(BCLog::SYS, "Flushing cache to disk, storing %d nevm blobs\n", mapCache.size());
-    bool res = WriteBatch(batch, fSync);
+    bool res = WriteIndexedBatch(batch, fSync);
     if(res) {
-        mapCache.clear();
+        ClearCache();
+        res = pnevmdatablobdb->FlushErase(vecBlobKeys);
     }
     return res;
 }
@@ -109,16 +270,19 @@ bool CNEVMDataDB::FlushErase(const NEVMDataVec &vecDataKeys) {
     if(vecDataKeys.empty())
         return true;
     CDBBatch batch(*this);    
+    std::set<std::vector<uint8_t>> setErased;
     for (const auto &key : vecDataKeys) {
-        batch.Erase(key);
+        if(!setErased.insert(key).second)
+            continue;
+        const bool fOnDisk = EraseMetaToBatch(batch, key);
         // remove from cache as well
         auto it = mapCache.find(key);
         if(it != mapCache.end())
-            mapCache.erase(it);
+            UncacheMeta(it, fOnDisk);
     }
     if(vecDataKeys.size() > 0)
         LogPrint(BCLog::SYS, "Flushing, erasing %d nevm blob keys\n", vecDataKeys.size());
-    return WriteBatch(batch, true) && pnevmdatablobdb->FlushErase(vecDataKeys);
+    return WriteIndexedBatch(batch, true) && pnevmdatablobdb->FlushErase(vecDataKeys);
 }
 bool CNEVMDataDB::FlushMempoolErase(const std::vector<uint8_t>& vchVersionHash, const uint256& txid) {
     LOCK(cs_cache);
@@ -129,13 +293,13 @@ bool CNEVMDataDB::FlushMempoolErase(const std::vector<uint8_t>& vchVersionHash,
             auto it = mapCache.find(vchVersionHash);
             if(it != mapCache.end()) {
                 if(it->second.txid != txid) {
-                    batch.Write(vchVersionHash, it->second);
-                    return WriteBatch(batch, true);
+                    WriteMetaToBatch(batch, vchVersionHash, it->second);
+                    return WriteIndexedBatch(batch, true);
                 }
-                mapCache.erase(it);
+                UncacheMeta(it, /*fOnDisk=*/true);
             }
-            batch.Erase(vchVersionHash);
-            return WriteBatch(batch, true) && pnevmdatablobdb->FlushErase({vchVersionHash});
+            EraseMetaToBatch(batch, vchVersionHash);
+            return WriteIndexedBatch(batch, true) && pnevmdatablobdb->FlushErase({vchVersionHash});
         }
         return true;
     }
@@ -143,15 +307,490 @@ bool CNEVMDataDB::FlushMempoolErase(const std::vector<uint8_t>& vchVersionHash,
     if(it == mapCache.end() || it->second.txid != txid) {
         return true;
     }
-    mapCache.erase(it);
+    UncacheMeta(it, /*fOnDisk=*/false);
     return pnevmdatablobdb->FlushErase({vchVersionHash});
 }
+bool CBlockWithNEVMData::Load()
+{
+    m_blobs.assign(m_block.vtx.size(), {-1, nullptr});
+    for (size_t i = 0; i < m_block.vtx.size(); i++) {
+        const CTransaction& tx = *m_block.vtx[i];
+        if (!tx.IsNEVMData()) {
+            continue;
+        }
+        const int nOut = GetSyscoinDataOutput(tx);
+        if (nOut == -1) {
+            return false;
+        }
+        if (!tx.vout[nOut].vchNEVMData.empty()) {
+            continue;
+        }
+        CNEVMData nevmData(tx.vout[nOut].scriptPubKey);
+        if (nevmData.IsNull()) {
+            return false;
+        }
+        auto blob = pnevmdatablobdb->ReadBlobShared(nevmData.vchVersionHash);
+        if (blob && !blob->empty()) {
+            m_blobs[i] = {nOut, std::move(blob)};
+        }
+    }
+    return true;
+}
+
+CNEVMBlobCache::Shard& CNEVMBlobCache::GetShard(const std::vector<uint8_t>& vchVersionHash) const
+{
+    return m_shards[GetShardIndex(vchVersionHash)];
+}
+
+CNEVMBlobCache::BlobPtr CNEVMBlobCache::Get(const std::vector<uint8_t>& vchVersionHash, uint64_t& nGeneration) const
+{
+    Shard& shard = GetShard(vchVersionHash);
+    {
+        LOCK(shard.cs);
+        auto it = shard.index.find(vchVersionHash);
+        if (it != shard.index.end()) {
+            shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+            m_hits++;
+            return it->second->second;
+        }
+        nGeneration = shard.nGeneration;
+    }
+    m_misses++;
+    return nullptr;
+}
+
+void CNEVMBlobCache::Put(const std::vector<uint8_t>& vchVersionHash, const BlobPtr& blob) const
+{
+    Shard& shard = GetShard(vchVersionHash);
+    LOCK(shard.cs);
+    Insert(shard, vchVersionHash, blob);
+}
+
+void CNEVMBlobCache::Put(const std::vector<uint8_t>& vchVersionHash, const BlobPtr& blob, uint64_t nGeneration) const
+{
+    Shard& shard = GetShard(vchVersionHash);
+    LOCK(shard.cs);
+    // the blob may have been erased from disk after it was read, only the next read may cache it again
+    if (shard.nGeneration != nGeneration) {
+        return;
+    }
+    Insert(shard, vchVersionHash, blob);
+}
+
+void CNEVMBlobCache::Insert(Shard& shard, const std::vector<uint8_t>& vchVersionHash, const BlobPtr& blob) const
+{
+    AssertLockHeld(shard.cs);
+    if (!blob || blob->size() > m_max_shard_bytes) {
+        return;
+    }
+    auto it = shard.index.find(vchVersionHash);
+    if (it != shard.index.end()) {
+        shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+        return;
+    }
+    while (!shard.lru.empty() && shard.nBytes + blob->size() > m_max_shard_bytes) {
+        const auto& [key, evicted] = shard.lru.back();
+        shard.nBytes -= evicted->size();
+        shard.index.erase(key);
+        shard.lru.pop_back();
+    }
+    shard.lru.emplace_front(vchVersionHash, blob);
+    shard.index.emplace(vchVersionHash, shard.lru.begin());
+    shard.nBytes += blob->size();
+}
+
+void CNEVMBlobCache::Erase(const std::vector<uint8_t>& vchVersionHash) const
+{
+    Shard& shard = GetShard(vchVersionHash);
+    LOCK(shard.cs);
+    // bumped even when nothing is cached, a read in flight may be about to put the blob back
+    shard.nGeneration++;
+    auto it = shard.index.find(vchVersionHash);
+    if (it == shard.index.end()) {
+        return;
+    }
+    shard.nBytes -= it->second->second->size();
+    shard.lru.erase(it->second);
+    shard.index.erase(it);
+}
+
+CNEVMBlobCache::Stats CNEVMBlobCache::GetStats() const
+{
+    Stats stats;
+    stats.nHits = m_hits;
+    stats.nMisses = m_misses;
+    stats.nMaxBytes = m_max_shard_bytes * SHARDS;
+    for (Shard& shard : m_shards) {
+        LOCK(shard.cs);
+        stats.nEntries += shard.lru.size();
+        stats.nBytes += shard.nBytes;
+    }
+    return stats;
+}
+
+static constexpr uint8_t DB_BLOB_FILE_INFO{'f'};
+static constexpr uint8_t DB_BLOB_LAST_FILE{'l'};
+static constexpr uint8_t DB_BLOB_VERSION{'v'};
+static constexpr uint8_t DB_BLOB_UPGRADE_CURSOR{'u'};
+static constexpr int BLOB_STORE_VERSION{1};
+static constexpr unsigned int BLOB_FILE_CHUNK_SIZE{0x1000000}; // 16 MiB
+static constexpr unsigned int MAX_BLOB_FILE_SIZE{0x8000000}; // 128 MiB
+
+CNEVMBlobFileMapping::CNEVMBlobFileMapping(const fs::path& path)
+{
+#ifdef WIN32
+    FILE* file = fsbridge::fopen(path, "rb");
+    if (!file) return;
+    AutoFile filein{file};
+    fseek(file, 0, SEEK_END);
+    const long nFileSize = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (nFileSize <= 0) return;
+    m_buffer.resize(nFileSize);
+    try {
+        filein.read(MakeWritableByteSpan(m_buffer));
+    } catch (const std::exception&) {
+        m_buffer.clear();
+        return;
+    }
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+#else
+    const int fd = open(fs::PathToString(path).c_str(), O_RDONLY);
+    if (fd == -1) return;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return;
+    }
+    void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    // the mapping keeps its own reference to the file, even after the file is pruned
+    close(fd);
+    if (addr == MAP_FAILED) return;
+    m_data = static_cast<const uint8_t*>(addr);
+    m_size = st.st_size;
+#endif
+}
+
+CNEVMBlobFileMapping::~CNEVMBlobFileMapping()
+{
+#ifndef WIN32
+    if (m_data) {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+#endif
+}
+
+static fs::path GetBlobDir(const DBParams& params)
+{
+    // the memory-only LevelDB has no directory, keep its blob files somewhere private instead
+    if (params.memory_only) {
+        return fs::path{fs::temp_directory_path()} / fs::u8path(strprintf("nevmblobs_%s", GetRandHash().ToString().substr(0, 16)));
+    }
+    return params.path / "blobs";
+}
+
+CNEVMDataBlobDB::CNEVMDataBlobDB(const DBParams& params, size_t nHotCacheBytes) :
+    CDBWrapper(params),
+    m_blob_dir(GetBlobDir(params)),
+    m_remove_on_close(params.memory_only),
+    m_blob_seq(m_blob_dir, "blob", BLOB_FILE_CHUNK_SIZE),
+    m_hot_blobs(nHotCacheBytes)
+{
+    // allocating space checks the free space of the directory, which FlatFileSeq only creates when opening a file
+    fs::create_directories(m_blob_dir);
+    LOCK(cs_blobs);
+    Read(DB_BLOB_LAST_FILE, m_last_file);
+    for (int nFile = 0; nFile <= m_last_file; ++nFile) {
+        CNEVMBlobFileInfo info;
+        if (Read(std::make_pair(DB_BLOB_FILE_INFO, nFile), info)) {
+            m_file_info.emplace(nFile, info);
+        }
+    }
+}
+
+CNEVMDataBlobDB::~CNEVMDataBlobDB()
+{
+    LOCK(cs_blobs);
+    m_mappings.clear();
+    if (m_remove_on_close) {
+        std::error_code ec;
+        fs::remove_all(m_blob_dir, ec);
+    }
+}
+
+bool CNEVMDataBlobDB::AppendBlobs(CDBBatch& batch, const std::vector<std::pair<std::vector<uint8_t>, const std::vector<uint8_t>*>>& vecBlobs, const int64_t nMedianTime)
+{
+    AssertLockHeld(cs_blobs);
+    if (vecBlobs.empty()) {
+        return true;
+    }
+    std::set<int> setDirtyFiles;
+    FILE* file{nullptr};
+    for (const auto& [key, data] : vecBlobs) {
+        CNEVMBlobFileInfo& info = m_file_info[m_last_file];
+        if (info.nSize > 0 && info.nSize + data->size() > MAX_BLOB_FILE_SIZE) {
+            if (file) {
+                fclose(file);
+                file = nullptr;
+            }
+            // the file is complete, drop its pre-allocated tail
+            if (!m_blob_seq.Flush(FlatFilePos(m_last_file, info.nSize), true)) {
+                return error("%s: failed to finalize blob file %d", __func__, m_last_file);
+            }
+            setDirtyFiles.erase(m_last_file);
+            ++m_last_file;
+        }
+        CNEVMBlobFileInfo& infoWrite = m_file_info[m_last_file];
+        const FlatFilePos pos(m_last_file, infoWrite.nSize);
+        bool out_of_space;
+        m_blob_seq.Allocate(pos, data->size(), out_of_space);
+        if (out_of_space) {
+            if (file) fclose(file);
+            return error("%s: out of disk space for blob file %d", __func__, m_last_file);
+        }
+        if (!file) {
+            file = m_blob_seq.Open(pos);
+            if (!file) {
+                return error("%s: failed to open blob file %d", __func__, m_last_file);
+            }
+        } else if (fseek(file, pos.nPos, SEEK_SET) != 0) {
+            fclose(file);
+            return error("%s: failed to seek in blob file %d", __func__, m_last_file);
+        }
+        if (!data->empty() && fwrite(data->data(), 1, data->size(), file) != data->size()) {
+            fclose(file);
+            return error("%s: failed to write blob file %d", __func__, m_last_file);
+        }
+        batch.Write(key, CNEVMBlobPos(m_last_file, pos.nPos, data->size()));
+        infoWrite.nBlobs++;
+        infoWrite.nSize += data->size();
+        infoWrite.nTimeLast = std::max(infoWrite.nTimeLast, nMedianTime);
+        setDirtyFiles.insert(m_last_file);
+    }
+    if (file) {
+        fclose(file);
+    }
+    // payload has to be durable before the index points at it
+    for (const int nFile : setDirtyFiles) {
+        if (!m_blob_seq.Flush(FlatFilePos(nFile, m_file_info[nFile].nSize))) {
+            return error("%s: failed to commit blob file %d", __func__, nFile);
+        }
+    }
+    for (const auto& [nFile, info] : m_file_info) {
+        batch.Write(std::make_pair(DB_BLOB_FILE_INFO, nFile), info);
+    }
+    batch.Write(DB_BLOB_LAST_FILE, m_last_file);
+    return true;
+}
+
+bool CNEVMDataBlobDB::WriteBlobs(const PoDAMAPMemory& mapBlobs)
+{
+    LOCK(cs_blobs);
+    std::vector<std::pair<std::vector<uint8_t>, const std::vector<uint8_t>*>> vecBlobs;
+    vecBlobs.reserve(mapBlobs.size());
+    int64_t nMedianTime{0};
+    for (const auto& [key, val] : mapBlobs) {
+        if (!val.vchNEVMData || Exists(key)) {
+            continue;
+        }
+        vecBlobs.emplace_back(key, val.vchNEVMData.get());
+        nMedianTime = std::max(nMedianTime, val.nMedianTime);
+    }
+    if (vecBlobs.empty()) {
+        return true;
+    }
+    CDBBatch batch(*this);
+    if (!AppendBlobs(batch, vecBlobs, nMedianTime) || !WriteBatch(batch, true)) {
+        return false;
+    }
+    for (const auto& [key, val] : mapBlobs) {
+        if (val.vchNEVMData) {
+            m_hot_blobs.Put(key, val.vchNEVMData);
+        }
+    }
+    return true;
+}
+
+bool CNEVMDataBlobDB::Upgrade(const std::function<bool()>& check_interrupt, size_t nMaxBatchBytes)
+{
+    int nVersion{0};
+    if (Read(DB_BLOB_VERSION, nVersion) && nVersion >= BLOB_STORE_VERSION) {
+        return true;
+    }
+    LOCK(cs_blobs);
+    // earlier versions kept the payload itself as the value of the version hash key, move them batch by batch
+    // and remember the last moved key so an interrupted upgrade never reads an index entry as a payload
+    std::vector<std::pair<std::vector<uint8_t>, std::vector<uint8_t>>> vecLegacy;
+    size_t nBatchBytes{0};
+    size_t nMoved{0};
+    const auto move_legacy = [&]() {
+        std::vector<std::pair<std::vector<uint8_t>, const std::vector<uint8_t>*>> vecBlobs;
+        for (const auto& [key, data] : vecLegacy) {
+            vecBlobs.emplace_back(key, &data);
+        }
+        CDBBatch batch(*this);
+        if (!AppendBlobs(batch, vecBlobs, 0)) {
+            return false;
+        }
+        batch.Write(DB_BLOB_UPGRADE_CURSOR, vecLegacy.back().first);
+        if (!WriteBatch(batch, true)) {
+            return false;
+        }
+        nMoved += vecLegacy.size();
+        vecLegacy.clear();
+        nBatchBytes = 0;
+        return true;
+    };
+    std::vector<uint8_t> vchCursor;
+    const bool fResume = Read(DB_BLOB_UPGRADE_CURSOR, vchCursor);
+    std::unique_ptr<CDBIterator> pcursor(NewIterator());
+    if (fResume) {
+        pcursor->Seek(vchCursor);
+        if (pcursor->Valid()) pcursor->Next();
+    } else {
+        pcursor->SeekToFirst();
+    }
+    while (pcursor->Valid()) {
+        std::vector<uint8_t> vchVersionHash;
+        std::vector<uint8_t> vchData;
+        if (!pcursor->GetKey(vchVersionHash) || vchVersionHash.size() != 32) {
+            // version hash keys sort before every bookkeeping key
+            break;
+        }
+        if (pcursor->GetValue(vchData) && !vchData.empty()) {
+            nBatchBytes += vchData.size();
+            vecLegacy.emplace_back(std::move(vchVersionHash), std::move(vchData));
+            if (nBatchBytes >= nMaxBatchBytes) {
+                if (!move_legacy()) {
+                    return error("%s: failed to move legacy nevm blobs", __func__);
+                }
+                if (check_interrupt && check_interrupt()) {
+                    LogPrintf("Interrupted moving nevm blobs into flat files after %d blobs\n", nMoved);
+                    return false;
+                }
+            }
+        }
+        pcursor->Next();
+    }
+    pcursor.reset();
+    if (!vecLegacy.empty() && !move_legacy()) {
+        return error("%s: failed to move legacy nevm blobs", __func__);
+    }
+    if (nMoved > 0) {
+        LogPrintf("Moved %d nevm blobs into flat files\n", nMoved);
+    }
+    CDBBatch batch(*this);
+    batch.Erase(DB_BLOB_UPGRADE_CURSOR);
+    batch.Write(DB_BLOB_VERSION, BLOB_STORE_VERSION);
+    return WriteBatch(batch, true);
+}
+
+std::shared_ptr<const CNEVMBlobFileMapping> CNEVMDataBlobDB::GetMapping(const int nFile, const size_t nMinSize) const
+{
+    AssertLockHeld(cs_blobs);
+    auto it = m_mappings.find(nFile);
+    // the file being appended to outgrows older mappings, those stay valid for the views still holding them
+    if (it != m_mappings.end() && it->second->size() >= nMinSize) {
+        return it->second;
+    }
+    auto mapping = std::make_shared<const CNEVMBlobFileMapping>(m_blob_seq.FileName(FlatFilePos(nFile, 0)));
+    if (!mapping->IsValid() || mapping->size() < nMinSize) {
+        return nullptr;
+    }
+    m_mappings[nFile] = mapping;
+    return mapping;
+}
+
+bool CNEVMDataBlobDB::ReadBlobView(const std::vector<uint8_t>& vchVersionHash, CNEVMBlobView& view) const
+{
+    CNEVMBlobPos pos;
+    if (!Read(vchVersionHash, pos) || pos.IsNull()) {
+        return false;
+    }
+    LOCK(cs_blobs);
+    auto mapping = GetMapping(pos.nFile, static_cast<size_t>(pos.nPos) + pos.nSize);
+    if (!mapping) {
+        return error("%s: blob %s missing from file %d", __func__, HexStr(vchVersionHash), pos.nFile);
+    }
+    view.data = mapping->GetSpan().subspan(pos.nPos, pos.nSize);
+    view.mapping = std::move(mapping);
+    return true;
+}
+
+CNEVMBlobCache::BlobPtr CNEVMDataBlobDB::ReadBlobShared(const std::vector<uint8_t>& vchVersionHash) const
+{
+    uint64_t nGeneration{0};
+    if (auto blob = m_hot_blobs.Get(vchVersionHash, nGeneration)) {
+        return blob;
+    }
+    CNEVMBlobView view;
+    if (!ReadBlobView(vchVersionHash, view)) {
+        return nullptr;
+    }
+    auto blob = std::make_shared<const std::vector<uint8_t>>(view.data.begin(), view.data.end());
+    // dropped if FlushErase() got to this blob after the lookup above
+    m_hot_blobs.Put(vchVersionHash, blob, nGeneration);
+    return blob;
+}
+
+bool CNEVMDataBlobDB::ReadBlob(const std::vector<uint8_t>& vchVersionHash, std::vector<uint8_t>& vchData) const
+{
+    const auto blob = ReadBlobShared(vchVersionHash);
+    if (!blob) {
+        return false;
+    }
+    vchData.assign(blob->begin(), blob->end());
+    return true;
+}
+
 bool CNEVMDataBlobDB::FlushErase(const NEVMDataVec &vecDataKeys) {
-    CDBBatch batch(*this);    
+    if (vecDataKeys.empty()) {
+        return true;
+    }
+    LOCK(cs_blobs);
+    CDBBatch batch(*this);
+    std::set<int> setTouchedFiles;
     for (const auto &key : vecDataKeys) {
+        m_hot_blobs.Erase(key);
+        CNEVMBlobPos pos;
+        if (!Read(key, pos)) {
+            continue;
+        }
         batch.Erase(key);
+        auto it = m_file_info.find(pos.nFile);
+        if (it != m_file_info.end() && it->second.nBlobs > 0) {
+            it->second.nBlobs--;
+            setTouchedFiles.insert(pos.nFile);
+        }
     }
-    return WriteBatch(batch, true);
+    std::vector<int> vecPrunedFiles;
+    for (const int nFile : setTouchedFiles) {
+        const CNEVMBlobFileInfo& info = m_file_info[nFile];
+        // the file still being appended to is never removed
+        if (info.nBlobs == 0 && nFile != m_last_file) {
+            batch.Erase(std::make_pair(DB_BLOB_FILE_INFO, nFile));
+            vecPrunedFiles.push_back(nFile);
+        } else {
+            batch.Write(std::make_pair(DB_BLOB_FILE_INFO, nFile), info);
+        }
+    }
+    if (!WriteBatch(batch, true)) {
+        return false;
+    }
+    for (const int nFile : vecPrunedFiles) {
+        m_file_info.erase(nFile);
+        m_mappings.erase(nFile);
+        const fs::path path = m_blob_seq.FileName(FlatFilePos(nFile, 0));
+        std::error_code ec;
+        fs::remove(path, ec);
+        if (ec) {
+            LogPrintf("FlushErase: unable to remove nevm blob file %s: %s\n", fs::PathToString(path), ec.message());
+        } else {
+            LogPrint(BCLog::SYS, "Pruned nevm blob file %s\n", fs::PathToString(path));
+        }
+    }
+    return true;
 }
 bool CNEVMDataDB::BlobExists(const std::vector<uint8_t>& vchVersionHash) {
     LOCK(cs_cache);
@@ -172,41 +811,49 @@ const PoDAMAPMemory& CNEVMDataDB::GetCache() const {
 }
 bool CNEVMDataDB::PruneToBatch(
     CDBBatch& batch,
-    CDBBatch& batchblob,
+    NEVMDataVec& vecBlobKeys,
     const int64_t nMedianTime)
 {
     AssertLockHeld(cs_cache);
     int nCount = 0;
+    std::set<std::vector<uint8_t>> setErased;
     auto it = mapCache.begin();
     while (it != mapCache.end()) {
         const int64_t entryTime = it->second.nMedianTime;
         bool isExpired = nMedianTime > (entryTime + NEVM_DATA_EXPIRE_TIME);
         if (isExpired) {
-            batchblob.Erase(it->first);
-            it = mapCache.erase(it);
+            // the blob goes away with the cache entry so drop any older metadata on disk too
+            const bool fOnDisk = EraseMetaToBatch(batch, it->first);
+            setErased.insert(it->first);
+            vecBlobKeys.emplace_back(it->first);
+            it = UncacheMeta(it, fOnDisk);
             ++nCount;
         } else {
             ++it;
         }
     }
-    
+    // walk the time index from the oldest entry and stop at the first one that has not expired
     std::unique_ptr<CDBIterator> pcursor(NewIterator());
-    pcursor->SeekToFirst();
-    std::vector<uint8_t> vchVersionHash;
-    MapPoDAPayloadMeta meta;
+    pcursor->Seek(std::make_pair(DB_PODA_TIME, CNEVMDataTimeKey()));
+    std::pair<uint8_t, CNEVMDataTimeKey> key;
+    uint32_t nSize;
     while (pcursor->Valid()) {
         try {
-            if (!pcursor->GetKey(vchVersionHash)) {
-                pcursor->Next();
-                continue;
+            if (!pcursor->GetKey(key) || key.first != DB_PODA_TIME) {
+                break;
             }
-            if (pcursor->GetValue(meta)) {
-                bool isExpired = nMedianTime > (meta.nMedianTime + NEVM_DATA_EXPIRE_TIME);
-                if (isExpired) {
-                    batch.Erase(vchVersionHash);
-                    batchblob.Erase(vchVersionHash);
-                    ++nCount;
-                }
+            if (nMedianTime <= (static_cast<int64_t>(key.second.nMedianTime) + NEVM_DATA_EXPIRE_TIME)) {
+                break;
+            }
+            const std::vector<uint8_t>& vchVersionHash = key.second.vchVersionHash;
+            // entries refreshed in the cache are rewritten with their new time by the caller
+            if (pcursor->GetValue(nSize) && !mapCache.count(vchVersionHash) && setErased.insert(vchVersionHash).second) {
+                batch.Erase(vchVersionHash);
+                batch.Erase(key);
+                m_stats.nBlobs -= std::min<uint64_t>(m_stats.nBlobs, 1);
+                m_stats.nSize -= std::min<uint64_t>(m_stats.nSize, nSize);
+                vecBlobKeys.emplace_back(vchVersionHash);
+                ++nCount;
             }
             pcursor->Next();
         } catch (const std::exception& e) {
@@ -223,9 +870,9 @@ bool CNEVMDataDB::PruneStandalone(const int64_t nMedianTime, bool fSync)
 {
     LOCK(cs_cache);
     CDBBatch batch(*this);
-    CDBBatch batchblob(*pnevmdatablobdb);
-    if (!PruneToBatch(batch, batchblob, nMedianTime)) {
+    NEVMDataVec vecBlobKeys;
+    if (!PruneToBatch(batch, vecBlobKeys, nMedianTime)) {
         return false;
     }
-    return WriteBatch(batch, fSync) && pnevmdatablobdb->WriteBatch(batchblob, fSync);
+    return WriteIndexedBatch(batch, fSync) && pnevmdatablobdb->FlushErase(vecBlobKeys);
 }
@@ -4,15 +4,26 @@
 
 #ifndef SYSCOIN_SERVICES_NEVMCONSENSUS_H
 #define SYSCOIN_SERVICES_NEVMCONSENSUS_H
+#include <primitives/block.h>
 #include <primitives/transaction.h>
 #include <dbwrapper.h>
 #include <consensus/params.h>
+#include <flatfile.h>
+#include <span.h>
 #include <util/hasher.h>
 #include <sync.h>
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <set>
+#include <unordered_map>
 class TxValidationState;
 class CCoinsViewCache;
 class CTxUndo;
-class CBlock;
 class BlockValidationState;
 class CBlockIndexDB;
 class CNEVMData;
@@ -26,28 +37,238 @@ enum class PoDAFlushSource {
     Block,
 };
     
+/** Running totals over the PoDA metadata stored on disk, kept in step with every write and erase */
+struct CNEVMDataStats {
+    uint64_t nBlobs{0};
+    uint64_t nSize{0};
+    SERIALIZE_METHODS(CNEVMDataStats, obj) {
+        READWRITE(VARINT(obj.nBlobs), VARINT(obj.nSize));
+    }
+};
+
 class CNEVMDataDB : public CDBWrapper {
 public:
     mutable Mutex cs_cache; // Mutex to protect cache operations
 private:
     PoDAMAPMemory mapCache GUARDED_BY(cs_cache);
+    CNEVMDataStats m_stats GUARDED_BY(cs_cache);
+    // entries in mapCache that do not refresh one already on disk, and the median times of everything cached
+    CNEVMDataStats m_cacheStats GUARDED_BY(cs_cache);
+    std::multiset<int64_t> m_cacheTimes GUARDED_BY(cs_cache);
+    void CacheMeta(const std::vector<uint8_t>& vchVersionHash, const MapPoDAPayloadMeta& meta, bool fOnDisk) EXCLUSIVE_LOCKS_REQUIRED(cs_cache);
+    PoDAMAPMemory::iterator UncacheMeta(PoDAMAPMemory::iterator it, bool fOnDisk) EXCLUSIVE_LOCKS_REQUIRED(cs_cache);
+    void ClearCache() EXCLUSIVE_LOCKS_REQUIRED(cs_cache);
+    void WriteMetaToBatch(CDBBatch& batch, const std::vector<uint8_t>& vchVersionHash, const MapPoDAPayloadMeta& meta) EXCLUSIVE_LOCKS_REQUIRED(cs_cache);
+    bool EraseMetaToBatch(CDBBatch& batch, const std::vector<uint8_t>& vchVersionHash) EXCLUSIVE_LOCKS_REQUIRED(cs_cache);
+    bool WriteIndexedBatch(CDBBatch& batch, bool fSync) EXCLUSIVE_LOCKS_REQUIRED(cs_cache);
 public:
-    using CDBWrapper::CDBWrapper;
+    explicit CNEVMDataDB(const DBParams& params);
+    bool Upgrade() EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
+    void GetStats(CNEVMDataStats& stats, int64_t& nOldest, int64_t& nNewest) EXCLUSIVE_LOCKS_REQUIRED(cs_cache);
     bool FlushErase(const NEVMDataVec &vecDataKeys) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
     bool FlushMempoolErase(const std::vector<uint8_t>& vchVersionHash, const uint256& txid) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
     bool FlushCacheToDisk(const int64_t nMedianTime, bool fSync = true) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
     void FlushDataToCache(const PoDAMAPMemory &mapPoDA, PoDAFlushSource source) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
     bool PruneStandalone(const int64_t nMedianTime, bool fSync = true) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
-    bool PruneToBatch(CDBBatch& batch,CDBBatch& batchblob,  const int64_t nMedianTime) EXCLUSIVE_LOCKS_REQUIRED(cs_cache);
+    bool PruneToBatch(CDBBatch& batch, NEVMDataVec& vecBlobKeys, const int64_t nMedianTime) EXCLUSIVE_LOCKS_REQUIRED(cs_cache);
     bool GetBlobMetaData(const std::vector<uint8_t>& vchVersionhash, MapPoDAPayloadMeta& meta) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
     bool BlobExists(const std::vector<uint8_t>& vchVersionhash) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
     const PoDAMAPMemory& GetCache() const EXCLUSIVE_LOCKS_REQUIRED(cs_cache);
 };
-class CNEVMDataBlobDB : public CDBWrapper {
-    public:
-        using CDBWrapper::CDBWrapper;
-        bool FlushErase(const NEVMDataVec &vecDataKeys);
+/** Default for -nevmblobcache, in MiB */
+static constexpr int64_t DEFAULT_NEVM_BLOB_CACHE_MB{128};
+/** Legacy blob bytes moved per batch when upgrading the blob store */
+static constexpr size_t MAX_BLOB_UPGRADE_BATCH_BYTES{64 << 20};
+/**
+ * Size bounded LRU of recently stored or read PoDA blobs. Freshly mined blobs are asked for over and
+ * over by RPC clients and by peers fetching the block, so they are kept in memory instead of being
+ * copied out of the blob files each time. Entries are spread over shards by salted version hash so that
+ * concurrent readers rarely wait on each other; every shard gets an equal part of the byte budget.
+ */
+class CNEVMBlobCache {
+public:
+    using BlobPtr = std::shared_ptr<const std::vector<uint8_t>>;
+    static constexpr size_t SHARDS{8};
+    struct Stats {
+        uint64_t nHits{0};
+        uint64_t nMisses{0};
+        uint64_t nEntries{0};
+        uint64_t nBytes{0};
+        uint64_t nMaxBytes{0};
+    };
+private:
+    struct Shard {
+        Mutex cs;
+        std::list<std::pair<std::vector<uint8_t>, BlobPtr>> lru GUARDED_BY(cs);
+        // version hashes are chosen by whoever publishes the blob, so bucket them by a salted hash
+        std::unordered_map<std::vector<uint8_t>, std::list<std::pair<std::vector<uint8_t>, BlobPtr>>::iterator, SaltedSipHasher> index GUARDED_BY(cs);
+        size_t nBytes GUARDED_BY(cs){0};
+        //! Bumped by every Erase(), a read that missed before an erase must not put the blob back
+        uint64_t nGeneration GUARDED_BY(cs){0};
     };
+    const size_t m_max_shard_bytes;
+    //! Picks the shard, salted so that a publisher cannot steer every blob into the same one
+    const SaltedSipHasher m_shard_hasher;
+    mutable std::array<Shard, SHARDS> m_shards;
+    mutable std::atomic<uint64_t> m_hits{0};
+    mutable std::atomic<uint64_t> m_misses{0};
+    Shard& GetShard(const std::vector<uint8_t>& vchVersionHash) const;
+    void Insert(Shard& shard, const std::vector<uint8_t>& vchVersionHash, const BlobPtr& blob) const EXCLUSIVE_LOCKS_REQUIRED(shard.cs);
+public:
+    explicit CNEVMBlobCache(size_t nMaxBytes) : m_max_shard_bytes(nMaxBytes / SHARDS) {}
+    /** Index of the shard that holds a version hash */
+    size_t GetShardIndex(const std::vector<uint8_t>& vchVersionHash) const { return m_shard_hasher(vchVersionHash) % SHARDS; }
+    /**
+     * Look a blob up and mark it most recently used, counts a hit or a miss. On a miss the shard
+     * generation is returned in nGeneration, to be handed to Put() with the blob read from disk.
+     */
+    BlobPtr Get(const std::vector<uint8_t>& vchVersionHash, uint64_t& nGeneration) const;
+    /** Insert a blob, evicting the least recently used ones of its shard to stay within budget */
+    void Put(const std::vector<uint8_t>& vchVersionHash, const BlobPtr& blob) const;
+    /** Insert a blob read from disk, unless its shard saw an Erase() since the Get() that returned nGeneration */
+    void Put(const std::vector<uint8_t>& vchVersionHash, const BlobPtr& blob, uint64_t nGeneration) const;
+    void Erase(const std::vector<uint8_t>& vchVersionHash) const;
+    Stats GetStats() const;
+};
+/** Location of a PoDA blob inside the flat blob files */
+struct CNEVMBlobPos {
+    int nFile{-1};
+    uint32_t nPos{0};
+    uint32_t nSize{0};
+    CNEVMBlobPos() {}
+    CNEVMBlobPos(int nFileIn, uint32_t nPosIn, uint32_t nSizeIn): nFile(nFileIn), nPos(nPosIn), nSize(nSizeIn) {}
+    SERIALIZE_METHODS(CNEVMBlobPos, obj) {
+        READWRITE(VARINT_MODE(obj.nFile, VarIntMode::NONNEGATIVE_SIGNED), VARINT(obj.nPos), VARINT(obj.nSize));
+    }
+    bool IsNull() const { return nFile == -1; }
+};
+/** Bookkeeping for one blob file, a file is deleted once its last live blob is erased */
+struct CNEVMBlobFileInfo {
+    uint32_t nBlobs{0};
+    uint32_t nSize{0};
+    int64_t nTimeLast{0};
+    SERIALIZE_METHODS(CNEVMBlobFileInfo, obj) {
+        READWRITE(VARINT(obj.nBlobs), VARINT(obj.nSize), obj.nTimeLast);
+    }
+};
+/** Read-only memory map of a blob file */
+class CNEVMBlobFileMapping {
+private:
+    const uint8_t* m_data{nullptr};
+    size_t m_size{0};
+#ifdef WIN32
+    std::vector<uint8_t> m_buffer;
+#endif
+public:
+    explicit CNEVMBlobFileMapping(const fs::path& path);
+    ~CNEVMBlobFileMapping();
+    CNEVMBlobFileMapping(const CNEVMBlobFileMapping&) = delete;
+    CNEVMBlobFileMapping& operator=(const CNEVMBlobFileMapping&) = delete;
+    bool IsValid() const { return m_data != nullptr; }
+    size_t size() const { return m_size; }
+    Span<const uint8_t> GetSpan() const { return {m_data, m_size}; }
+};
+/** A blob served straight out of a file mapping, the mapping stays alive for as long as the view */
+struct CNEVMBlobView {
+    std::shared_ptr<const CNEVMBlobFileMapping> mapping;
+    Span<const uint8_t> data;
+};
+/**
+ * PoDA blob payloads are appended to flat files (nevmblobdata/blobs/blob?????.dat) and only their
+ * position is kept in LevelDB, so compaction never rewrites payload bytes. Reads are served from a
+ * memory map of the file and pruning removes whole files once nothing in them is referenced.
+ */
+class CNEVMDataBlobDB : public CDBWrapper {
+private:
+    mutable Mutex cs_blobs;
+    const fs::path m_blob_dir;
+    const bool m_remove_on_close;
+    FlatFileSeq m_blob_seq;
+    int m_last_file GUARDED_BY(cs_blobs){0};
+    std::map<int, CNEVMBlobFileInfo> m_file_info GUARDED_BY(cs_blobs);
+    mutable std::map<int, std::shared_ptr<const CNEVMBlobFileMapping>> m_mappings GUARDED_BY(cs_blobs);
+    const CNEVMBlobCache m_hot_blobs;
+    bool AppendBlobs(CDBBatch& batch, const std::vector<std::pair<std::vector<uint8_t>, const std::vector<uint8_t>*>>& vecBlobs, const int64_t nMedianTime) EXCLUSIVE_LOCKS_REQUIRED(cs_blobs);
+    std::shared_ptr<const CNEVMBlobFileMapping> GetMapping(const int nFile, const size_t nMinSize) const EXCLUSIVE_LOCKS_REQUIRED(cs_blobs);
+public:
+    explicit CNEVMDataBlobDB(const DBParams& params, size_t nHotCacheBytes = DEFAULT_NEVM_BLOB_CACHE_MB << 20);
+    ~CNEVMDataBlobDB();
+    /**
+     * Move blobs stored as LevelDB values by older versions into the flat files, nMaxBatchBytes at a time.
+     * check_interrupt is asked after every batch, an interrupted upgrade returns false and resumes after the
+     * last moved blob when run again.
+     */
+    bool Upgrade(const std::function<bool()>& check_interrupt = {}, size_t nMaxBatchBytes = MAX_BLOB_UPGRADE_BATCH_BYTES) EXCLUSIVE_LOCKS_REQUIRED(!cs_blobs);
+    /** Append blobs that are not stored yet and index them */
+    bool WriteBlobs(const PoDAMAPMemory& mapBlobs) EXCLUSIVE_LOCKS_REQUIRED(!cs_blobs);
+    bool ReadBlob(const std::vector<uint8_t>& vchVersionHash, std::vector<uint8_t>& vchData) const EXCLUSIVE_LOCKS_REQUIRED(!cs_blobs);
+    bool ReadBlobView(const std::vector<uint8_t>& vchVersionHash, CNEVMBlobView& view) const EXCLUSIVE_LOCKS_REQUIRED(!cs_blobs);
+    /** Read a blob through the hot blob cache, returns nullptr if it is not stored */
+    CNEVMBlobCache::BlobPtr ReadBlobShared(const std::vector<uint8_t>& vchVersionHash) const EXCLUSIVE_LOCKS_REQUIRED(!cs_blobs);
+    CNEVMBlobCache::Stats GetCacheStats() const { return m_hot_blobs.GetStats(); }
+    bool FlushErase(const NEVMDataVec &vecDataKeys) EXCLUSIVE_LOCKS_REQUIRED(!cs_blobs);
+};
+/**
+ * A block read from disk without its PoDA blobs, serialized to the network as if FillNEVMData had run
+ * on it. Blob bytes are written straight from the hot blob cache while the block is streamed, so
+ * serving a block to many peers neither rebuilds its data transactions nor copies a blob per peer.
+ */
+class CBlockWithNEVMData {
+private:
+    const CBlock& m_block;
+    // data output and blob to inject for every transaction, the output is -1 if nothing is injected
+    std::vector<std::pair<int, CNEVMBlobCache::BlobPtr>> m_blobs;
+
+    template<typename Stream>
+    void SerializeTransaction(Stream& s, const CTransaction& tx, const int nOut, const std::vector<uint8_t>& vchNEVMData) const {
+        const bool fWitness = !(s.GetVersion() & SERIALIZE_TRANSACTION_NO_WITNESS) && tx.HasWitness();
+        s.SetTxVersion(tx.nVersion);
+        s << tx.nVersion;
+        if (fWitness) {
+            s << std::vector<CTxIn>{};
+            s << uint8_t{1};
+        }
+        s << tx.vin;
+        WriteCompactSize(s, tx.vout.size());
+        for (size_t i = 0; i < tx.vout.size(); i++) {
+            const CTxOut& txout = tx.vout[i];
+            // same condition as CTxOut uses to put the blob on the wire
+            if (static_cast<int>(i) != nOut || !txout.scriptPubKey.IsUnspendable() || !IsSyscoinNEVMDataTx(tx.nVersion) ||
+                    (s.GetType() & SER_NO_PODA) || !(s.GetType() & SER_NETWORK)) {
+                s << txout;
+                continue;
+            }
+            s << txout.nValue << txout.scriptPubKey << vchNEVMData;
+        }
+        if (fWitness) {
+            for (const CTxIn& txin : tx.vin) {
+                s << txin.scriptWitness.stack;
+            }
+        }
+        s << tx.nLockTime;
+    }
+public:
+    explicit CBlockWithNEVMData(const CBlock& block) : m_block(block) {}
+    /** Look up the blobs to inject, fails where FillNEVMData would. Blobs pruned from the store stay empty. */
+    bool Load();
+
+    template<typename Stream>
+    void Serialize(Stream& s) const {
+        s << static_cast<const CBlockHeader&>(m_block);
+        WriteCompactSize(s, m_block.vtx.size());
+        for (size_t i = 0; i < m_block.vtx.size(); i++) {
+            const auto& [nOut, blob] = m_blobs[i];
+            if (blob) {
+                SerializeTransaction(s, *m_block.vtx[i], nOut, *blob);
+            } else {
+                s << m_block.vtx[i];
+            }
+        }
+        if (m_block.IsNEVM() && !(s.GetType() & SER_GETHASH) && !(s.GetType() & SER_SIZE)) {
+            s << m_block.vchNEVMBlockData;
+        }
+    }
+};
 extern std::unique_ptr<CNEVMDataDB> pnevmdatadb;
 extern std::unique_ptr<CNEVMDataBlobDB> pnevmdatablobdb;
 bool DisconnectSyscoinTransaction(const CTransaction& tx, NEVMMintTxSet &setMintTxs);
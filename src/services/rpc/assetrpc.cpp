@@ -11,6 +11,8 @@
 #include <thread>
 #include <policy/rbf.h>
 #include <policy/policy.h>
+#include <index/assetallocationindex.h>
+#include <index/assetstatsindex.h>
 #include <index/txindex.h>
 #include <core_io.h>
 #include <rpc/blockchain.h>
@@ -24,52 +26,6 @@
 #include <logging.h>
 using node::GetTransaction;
 
-int CheckActorsInTransactionGraph(const CTxMemPool& mempool, const uint256& lookForTxHash) {
-    LOCK(cs_main);
-    LOCK(mempool.cs);
-    {
-        CTxMemPool::setEntries setAncestors;
-        const CTransactionRef txRef = mempool.get(lookForTxHash);
-        if (!txRef)
-            return ZDAG_NOT_FOUND;
-        if(!IsZdagTx(txRef->nVersion))
-            return ZDAG_WARNING_NOT_ZDAG_TX;
-        // the zdag tx should be under MTU of IP packet
-        if(txRef->GetTotalSize() > MAX_STANDARD_ZDAG_TX_SIZE)
-            return ZDAG_WARNING_SIZE_OVER_POLICY;
-        // check if any inputs are dbl spent, reject if so
-        if(mempool.existsConflicts(*txRef))
-            return ZDAG_MAJOR_CONFLICT;        
-
-        // check this transaction isn't RBF enabled
-        RBFTransactionState rbfState = IsRBFOptIn(*txRef, mempool, setAncestors);
-        if (rbfState == RBFTransactionState::UNKNOWN)
-            return ZDAG_NOT_FOUND;
-        else if (rbfState == RBFTransactionState::REPLACEABLE_BIP125)
-            return ZDAG_WARNING_RBF;
-        for (CTxMemPool::txiter it : setAncestors) {
-            const CTransactionRef& ancestorTxRef = it->GetSharedTx();
-            // should be under MTU of IP packet
-            if(ancestorTxRef->GetTotalSize() > MAX_STANDARD_ZDAG_TX_SIZE)
-                return ZDAG_WARNING_SIZE_OVER_POLICY;
-            // check if any ancestor inputs are dbl spent, reject if so
-            if(mempool.existsConflicts(*ancestorTxRef))
-                return ZDAG_MAJOR_CONFLICT;
-            if(!IsZdagTx(ancestorTxRef->nVersion))
-                return ZDAG_WARNING_NOT_ZDAG_TX;
-        }  
-    }
-    return ZDAG_STATUS_OK;
-}
-
-int VerifyTransactionGraph(const CTxMemPool& mempool, const uint256& lookForTxHash) {  
-    int status = CheckActorsInTransactionGraph(mempool, lookForTxHash);
-    if(status != ZDAG_STATUS_OK){
-        return status;
-    }
-	return ZDAG_STATUS_OK;
-}
-
 static RPCHelpMan assetallocationverifyzdag()
 {
     return RPCHelpMan{"assetallocationverifyzdag",
@@ -98,12 +54,58 @@ static RPCHelpMan assetallocationverifyzdag()
 	uint256 txid;
 	txid.SetHex(params[0].get_str());
 	UniValue oAssetAllocationStatus(UniValue::VOBJ);
-    oAssetAllocationStatus.pushKV("status", VerifyTransactionGraph(mempool, txid));
+    oAssetAllocationStatus.pushKV("status", mempool.GetZdagStatus({txid}).front());
 	return oAssetAllocationStatus;
 },
     };
 }
 
+static RPCHelpMan assetallocationverifyzdagbatch()
+{
+    return RPCHelpMan{"assetallocationverifyzdagbatch",
+        "\nShow the Z-DAG status of several ZDAG transactions at once, see assetallocationverifyzdag for the status levels.\n",
+        {
+            {"txids", RPCArg::Type::ARR, RPCArg::Optional::NO, "The transaction ids of the ZDAG transactions.",
+                {
+                    {"txid", RPCArg::Type::STR_HEX, RPCArg::Optional::OMITTED, "A transaction id"},
+                },
+            },
+        },
+        RPCResult{
+            RPCResult::Type::ARR, "", "",
+            {
+                {RPCResult::Type::OBJ, "", "",
+                {
+                    {RPCResult::Type::STR_HEX, "txid", "The transaction id"},
+                    {RPCResult::Type::NUM, "status", "The status level of the transaction"},
+                }},
+            }},
+        RPCExamples{
+            HelpExampleCli("assetallocationverifyzdagbatch", "\"[\\\"txid\\\",...]\"")
+            + HelpExampleRpc("assetallocationverifyzdagbatch", "[\"txid\",...]")
+        },
+    [&](const RPCHelpMan& self, const node::JSONRPCRequest& request) -> UniValue
+{
+    const CTxMemPool& mempool = EnsureAnyMemPool(request.context);
+    const UniValue& txids = request.params[0].get_array();
+    std::vector<uint256> vTxids;
+    vTxids.reserve(txids.size());
+    for (size_t i = 0; i < txids.size(); ++i) {
+        vTxids.push_back(ParseHashV(txids[i], "txid"));
+    }
+    const std::vector<int> vStatus = mempool.GetZdagStatus(vTxids);
+    UniValue result(UniValue::VARR);
+    for (size_t i = 0; i < vTxids.size(); ++i) {
+        UniValue oAssetAllocationStatus(UniValue::VOBJ);
+        oAssetAllocationStatus.pushKV("txid", vTxids[i].GetHex());
+        oAssetAllocationStatus.pushKV("status", vStatus[i]);
+        result.push_back(std::move(oAssetAllocationStatus));
+    }
+    return result;
+},
+    };
+}
+
 static RPCHelpMan syscoindecoderawtransaction()
 {
     return RPCHelpMan{"syscoindecoderawtransaction",
@@ -234,14 +236,370 @@ static RPCHelpMan syscoincheckmint()
     };
 }
 
+UniValue NEVMTxRootsToJSON(const std::vector<uint256>& vecBlockHashes, const std::vector<std::optional<NEVMTxRoot>>& vecTxRoots)
+{
+    UniValue result(UniValue::VARR);
+    for (size_t i = 0; i < vecBlockHashes.size(); ++i) {
+        UniValue entry(UniValue::VOBJ);
+        entry.pushKV("blockhash", vecBlockHashes[i].GetHex());
+        entry.pushKV("found", vecTxRoots[i].has_value());
+        if (vecTxRoots[i]) {
+            entry.pushKV("txroot", vecTxRoots[i]->nTxRoot.GetHex());
+            entry.pushKV("receiptroot", vecTxRoots[i]->nReceiptRoot.GetHex());
+        }
+        result.push_back(std::move(entry));
+    }
+    return result;
+}
+
+UniValue NEVMMintsToJSON(const std::vector<uint256>& vecTxHashes, const std::vector<bool>& vecMinted)
+{
+    UniValue result(UniValue::VARR);
+    for (size_t i = 0; i < vecTxHashes.size(); ++i) {
+        UniValue entry(UniValue::VOBJ);
+        entry.pushKV("nevm_txhash", vecTxHashes[i].GetHex());
+        entry.pushKV("minted", static_cast<bool>(vecMinted[i]));
+        result.push_back(std::move(entry));
+    }
+    return result;
+}
+
+/** Parse an array of NEVM hashes, each optionally 0x prefixed */
+static std::vector<uint256> ParseNEVMHashes(const UniValue& hashes, const std::string& strName)
+{
+    if (hashes.size() > MAX_NEVM_BATCH_LOOKUP) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, strprintf("Too many %s, max %d", strName, MAX_NEVM_BATCH_LOOKUP));
+    }
+    std::vector<uint256> vecHashes(hashes.size());
+    for (size_t i = 0; i < hashes.size(); ++i) {
+        if (!ParseHashStr(RemovePrefix(hashes[i].get_str(), "0x"), vecHashes[i])) {
+            throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, strprintf("Could not read %s entry %d", strName, i));
+        }
+    }
+    return vecHashes;
+}
+
+static RPCHelpMan syscoingettxrootsbatch()
+{
+    return RPCHelpMan{"syscoingettxrootsbatch",
+    "\nGet NEVM transaction and receipt roots of several block hashes at once, see syscoingettxroots.\n",
+    {
+        {"blockhashes", RPCArg::Type::ARR, RPCArg::Optional::NO, "The block hashes to lookup.",
+            {
+                {"blockhash", RPCArg::Type::STR_HEX, RPCArg::Optional::OMITTED, "A block hash"},
+            },
+        },
+    },
+    RPCResult{
+        RPCResult::Type::ARR, "", "In request order",
+        {
+            {RPCResult::Type::OBJ, "", "",
+            {
+                {RPCResult::Type::STR_HEX, "blockhash", "The block hash"},
+                {RPCResult::Type::BOOL, "found", "Whether roots are stored for the block"},
+                {RPCResult::Type::STR_HEX, "txroot", /*optional=*/true, "The transaction merkle root"},
+                {RPCResult::Type::STR_HEX, "receiptroot", /*optional=*/true, "The receipt merkle root"},
+            }},
+        }},
+    RPCExamples{
+        HelpExampleCli("syscoingettxrootsbatch", "\"[\\\"blockhash\\\",...]\"")
+        + HelpExampleRpc("syscoingettxrootsbatch", "[\"blockhash\",...]")
+    },
+    [&](const RPCHelpMan& self, const node::JSONRPCRequest& request) -> UniValue
+{
+    const std::vector<uint256> vecBlockHashes = ParseNEVMHashes(request.params[0].get_array(), "blockhashes");
+    if (!pnevmtxrootsdb) {
+        throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Could not read transaction roots");
+    }
+    std::vector<std::optional<NEVMTxRoot>> vecTxRoots;
+    pnevmtxrootsdb->ReadTxRoots(vecBlockHashes, vecTxRoots);
+    return NEVMTxRootsToJSON(vecBlockHashes, vecTxRoots);
+},
+    };
+}
+
+static RPCHelpMan syscoincheckmintbatch()
+{
+    return RPCHelpMan{"syscoincheckmintbatch",
+    "\nCheck whether several NEVM tx hashes have already been minted on Syscoin.\n",
+    {
+        {"nevm_txhashes", RPCArg::Type::ARR, RPCArg::Optional::NO, "NEVM tx hashes used to burn funds to move to Syscoin.",
+            {
+                {"nevm_txhash", RPCArg::Type::STR_HEX, RPCArg::Optional::OMITTED, "A NEVM tx hash"},
+            },
+        },
+    },
+    RPCResult{
+        RPCResult::Type::ARR, "", "In request order",
+        {
+            {RPCResult::Type::OBJ, "", "",
+            {
+                {RPCResult::Type::STR_HEX, "nevm_txhash", "The NEVM tx hash"},
+                {RPCResult::Type::BOOL, "minted", "Whether a mint of the NEVM tx is confirmed"},
+            }},
+        }},
+    RPCExamples{
+        HelpExampleCli("syscoincheckmintbatch", "\"[\\\"nevm_txhash\\\",...]\"")
+        + HelpExampleRpc("syscoincheckmintbatch", "[\"nevm_txhash\",...]")
+    },
+    [&](const RPCHelpMan& self, const node::JSONRPCRequest& request) -> UniValue
+{
+    const std::vector<uint256> vecTxHashes = ParseNEVMHashes(request.params[0].get_array(), "nevm_txhashes");
+    if (!pnevmtxmintdb) {
+        throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Could not read mint transactions");
+    }
+    std::vector<bool> vecMinted;
+    pnevmtxmintdb->ExistsTxs(vecTxHashes, vecMinted);
+    return NEVMMintsToJSON(vecTxHashes, vecMinted);
+},
+    };
+}
+
+static RPCHelpMan syscoingetmintfilterinfo()
+{
+    return RPCHelpMan{"syscoingetmintfilterinfo",
+    "\nReturns the state of the in-memory filter that answers bridge mint replay lookups without reading the database.\n",
+    {},
+    RPCResult{
+        RPCResult::Type::OBJ, "", "",
+        {
+            {RPCResult::Type::NUM, "elements", "Number of NEVM tx hashes added to the filter"},
+            {RPCResult::Type::NUM, "capacity", "Number of hashes the filter is sized for before it is rebuilt"},
+            {RPCResult::Type::NUM, "hashfuncs", "Number of hash functions per element"},
+            {RPCResult::Type::NUM, "bytes", "Memory used by the filter"},
+            {RPCResult::Type::NUM, "estimated_fp_rate", "False positive rate expected from the bits set"},
+            {RPCResult::Type::NUM, "lookups", "Lookups that missed the pending cache and consulted the filter"},
+            {RPCResult::Type::NUM, "filtered", "Lookups answered as absent without reading the database"},
+            {RPCResult::Type::NUM, "false_positives", "Lookups the filter passed on that were not found in the database"},
+            {RPCResult::Type::NUM, "observed_fp_rate", "false_positives / (false_positives + filtered)"},
+        }},
+    RPCExamples{
+        HelpExampleCli("syscoingetmintfilterinfo", "")
+        + HelpExampleRpc("syscoingetmintfilterinfo", "")
+    },
+    [&](const RPCHelpMan& self, const node::JSONRPCRequest& request) -> UniValue
+{
+    if(!pnevmtxmintdb) {
+        throw JSONRPCError(RPC_INTERNAL_ERROR, "Mint replay database not loaded");
+    }
+    CNEVMMintFilterStats stats;
+    pnevmtxmintdb->GetFilterStats(stats);
+    const uint64_t nAbsent = stats.nFalsePositives + stats.nFilteredOut;
+    UniValue output(UniValue::VOBJ);
+    output.pushKV("elements", stats.nElements);
+    output.pushKV("capacity", stats.nCapacity);
+    output.pushKV("hashfuncs", (uint64_t)stats.nHashFuncs);
+    output.pushKV("bytes", (uint64_t)stats.nBytes);
+    output.pushKV("estimated_fp_rate", stats.dEstimatedFPRate);
+    output.pushKV("lookups", stats.nLookups);
+    output.pushKV("filtered", stats.nFilteredOut);
+    output.pushKV("false_positives", stats.nFalsePositives);
+    output.pushKV("observed_fp_rate", nAbsent > 0 ? (double)stats.nFalsePositives / nAbsent : 0.0);
+    return output;
+},
+    };
+}
+
+UniValue AssetAllocationBalancesToJSON(const std::vector<std::pair<uint64_t, CAmount>>& vecBalances)
+{
+    UniValue result(UniValue::VARR);
+    for (const auto& [nAsset, nBalance] : vecBalances) {
+        UniValue entry(UniValue::VOBJ);
+        entry.pushKV("asset_guid", nAsset);
+        entry.pushKV("balance", ValueFromAmount(nBalance));
+        result.push_back(std::move(entry));
+    }
+    return result;
+}
+
+UniValue AssetAllocationHistoryToJSON(const std::vector<AssetAllocationDelta>& vecHistory)
+{
+    UniValue result(UniValue::VARR);
+    for (const AssetAllocationDelta& delta : vecHistory) {
+        UniValue entry(UniValue::VOBJ);
+        entry.pushKV("height", delta.height);
+        entry.pushKV("txid", delta.txid.GetHex());
+        entry.pushKV("amount", ValueFromAmount(delta.amount));
+        result.push_back(std::move(entry));
+    }
+    return result;
+}
+
+static const AssetAllocationIndex& EnsureAssetAllocationIndex()
+{
+    if (!g_asset_allocation_index) {
+        throw JSONRPCError(RPC_MISC_ERROR, "Asset allocation index is not enabled, start with -assetallocationindex");
+    }
+    if (!g_asset_allocation_index->BlockUntilSyncedToCurrentChain()) {
+        const IndexSummary summary{g_asset_allocation_index->GetSummary()};
+        throw JSONRPCError(RPC_INTERNAL_ERROR, strprintf("Unable to get data because assetallocationindex is still syncing. Current height: %d", summary.best_block_height));
+    }
+    return *g_asset_allocation_index;
+}
+
+static CScript ScriptFromAddress(const std::string& strAddress)
+{
+    const CTxDestination dest = DecodeDestination(strAddress);
+    if (!IsValidDestination(dest)) {
+        throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Invalid address: " + strAddress);
+    }
+    return GetScriptForDestination(dest);
+}
+
+static RPCHelpMan assetallocationbalances()
+{
+    return RPCHelpMan{"assetallocationbalances",
+    "\nReturns the confirmed asset balances held by an address. Requires -assetallocationindex.\n",
+    {
+        {"address", RPCArg::Type::STR, RPCArg::Optional::NO, "The address holding the allocations."},
+        {"asset_guid", RPCArg::Type::NUM, RPCArg::Optional::OMITTED, "Only return the balance of this asset."},
+    },
+    RPCResult{
+        RPCResult::Type::ARR, "", "",
+        {
+            {RPCResult::Type::OBJ, "", "",
+            {
+                {RPCResult::Type::NUM, "asset_guid", "Asset guid"},
+                {RPCResult::Type::STR_AMOUNT, "balance", "Confirmed balance"},
+            }},
+        }},
+    RPCExamples{
+        HelpExampleCli("assetallocationbalances", "\"sys1q...\"")
+        + HelpExampleCli("assetallocationbalances", "\"sys1q...\" 123456")
+        + HelpExampleRpc("assetallocationbalances", "\"sys1q...\", 123456")
+    },
+    [&](const RPCHelpMan& self, const node::JSONRPCRequest& request) -> UniValue
+{
+    const CScript script = ScriptFromAddress(request.params[0].get_str());
+    const AssetAllocationIndex& index = EnsureAssetAllocationIndex();
+    if (request.params[1].isNull()) {
+        return AssetAllocationBalancesToJSON(index.FindBalances(script));
+    }
+    const uint64_t nAsset = request.params[1].getInt<uint64_t>();
+    CAmount nBalance{0};
+    std::vector<std::pair<uint64_t, CAmount>> vecBalances;
+    if (index.FindBalance(script, nAsset, nBalance)) {
+        vecBalances.emplace_back(nAsset, nBalance);
+    }
+    return AssetAllocationBalancesToJSON(vecBalances);
+},
+    };
+}
+
+static RPCHelpMan assetallocationhistory()
+{
+    return RPCHelpMan{"assetallocationhistory",
+    "\nReturns the confirmed balance changes of an asset held by an address, oldest first. Requires -assetallocationindex.\n",
+    {
+        {"address", RPCArg::Type::STR, RPCArg::Optional::NO, "The address holding the allocations."},
+        {"asset_guid", RPCArg::Type::NUM, RPCArg::Optional::NO, "The asset guid."},
+        {"from_height", RPCArg::Type::NUM, RPCArg::Default{0}, "Skip changes confirmed below this height."},
+        {"count", RPCArg::Type::NUM, RPCArg::Default{(int)MAX_ASSETALLOCATION_HISTORY}, strprintf("The number of changes to return (at most %d).", MAX_ASSETALLOCATION_HISTORY)},
+    },
+    RPCResult{
+        RPCResult::Type::ARR, "", "",
+        {
+            {RPCResult::Type::OBJ, "", "",
+            {
+                {RPCResult::Type::NUM, "height", "Height of the block confirming the change"},
+                {RPCResult::Type::STR_HEX, "txid", "The transaction id"},
+                {RPCResult::Type::STR_AMOUNT, "amount", "Net change of the balance in this transaction"},
+            }},
+        }},
+    RPCExamples{
+        HelpExampleCli("assetallocationhistory", "\"sys1q...\" 123456")
+        + HelpExampleCli("assetallocationhistory", "\"sys1q...\" 123456 1000000 100")
+        + HelpExampleRpc("assetallocationhistory", "\"sys1q...\", 123456, 1000000, 100")
+    },
+    [&](const RPCHelpMan& self, const node::JSONRPCRequest& request) -> UniValue
+{
+    const CScript script = ScriptFromAddress(request.params[0].get_str());
+    const uint64_t nAsset = request.params[1].getInt<uint64_t>();
+    const int nFromHeight = request.params[2].isNull() ? 0 : request.params[2].getInt<int>();
+    const int nCount = request.params[3].isNull() ? (int)MAX_ASSETALLOCATION_HISTORY : request.params[3].getInt<int>();
+    if (nFromHeight < 0) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "from_height must not be negative");
+    }
+    if (nCount < 1 || (size_t)nCount > MAX_ASSETALLOCATION_HISTORY) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, strprintf("count must be between 1 and %d", MAX_ASSETALLOCATION_HISTORY));
+    }
+    const AssetAllocationIndex& index = EnsureAssetAllocationIndex();
+    return AssetAllocationHistoryToJSON(index.FindHistory(script, nAsset, nFromHeight, nCount));
+},
+    };
+}
+
+static RPCHelpMan getassetstats()
+{
+    return RPCHelpMan{"getassetstats",
+    "\nReturns the circulating supply, mint and burn totals and holder count of an asset as of a height of the active chain. Requires -assetstatsindex.\n",
+    {
+        {"asset_guid", RPCArg::Type::NUM, RPCArg::Optional::NO, "The asset guid."},
+        {"height", RPCArg::Type::NUM, RPCArg::DefaultHint{"the current best block"}, "The height to report the totals at."},
+    },
+    RPCResult{
+        RPCResult::Type::OBJ, "", "",
+        {
+            {RPCResult::Type::NUM, "asset_guid", "Asset guid"},
+            {RPCResult::Type::NUM, "height", "The height the totals are reported at"},
+            {RPCResult::Type::NUM, "last_change_height", "Height of the last block at or below height that changed the totals"},
+            {RPCResult::Type::STR_AMOUNT, "supply", "Allocations held in spendable outputs"},
+            {RPCResult::Type::STR_AMOUNT, "minted", "Allocations created by mints and SYS to SYSX burns"},
+            {RPCResult::Type::STR_AMOUNT, "burned", "Allocations burned to NEVM or SYS"},
+            {RPCResult::Type::NUM, "holders", "Number of addresses holding a non-zero balance"},
+        }},
+    RPCExamples{
+        HelpExampleCli("getassetstats", "123456")
+        + HelpExampleCli("getassetstats", "123456 1000000")
+        + HelpExampleRpc("getassetstats", "123456, 1000000")
+    },
+    [&](const RPCHelpMan& self, const node::JSONRPCRequest& request) -> UniValue
+{
+    const uint64_t nAsset = request.params[0].getInt<uint64_t>();
+    if (!g_asset_stats_index) {
+        throw JSONRPCError(RPC_MISC_ERROR, "Asset stats index is not enabled, start with -assetstatsindex");
+    }
+    const IndexSummary summary{g_asset_stats_index->GetSummary()};
+    if (!g_asset_stats_index->BlockUntilSyncedToCurrentChain()) {
+        throw JSONRPCError(RPC_INTERNAL_ERROR, strprintf("Unable to get data because assetstatsindex is still syncing. Current height: %d", summary.best_block_height));
+    }
+    int nHeight = g_asset_stats_index->GetSummary().best_block_height;
+    if (!request.params[1].isNull()) {
+        const int nRequested = request.params[1].getInt<int>();
+        if (nRequested < 0 || nRequested > nHeight) {
+            throw JSONRPCError(RPC_INVALID_PARAMETER, strprintf("Target block height %d out of range [0, %d]", nRequested, nHeight));
+        }
+        nHeight = nRequested;
+    }
+    const AssetStats stats = g_asset_stats_index->LookUpStats(nAsset, nHeight).value_or(AssetStats{});
+    UniValue output(UniValue::VOBJ);
+    output.pushKV("asset_guid", nAsset);
+    output.pushKV("height", nHeight);
+    output.pushKV("last_change_height", stats.height);
+    output.pushKV("supply", ValueFromAmount(stats.supply));
+    output.pushKV("minted", ValueFromAmount(stats.minted));
+    output.pushKV("burned", ValueFromAmount(stats.burned));
+    output.pushKV("holders", stats.holders);
+    return output;
+},
+    };
+}
+
 // clang-format on
 void RegisterAssetRPCCommands(CRPCTable &t)
 {
     static const CRPCCommand commands[]{
         {"syscoin", &syscoingettxroots},
+        {"syscoin", &syscoingettxrootsbatch},
         {"syscoin", &syscoindecoderawtransaction},
         {"syscoin", &assetallocationverifyzdag},
+        {"syscoin", &assetallocationverifyzdagbatch},
         {"syscoin", &syscoincheckmint},
+        {"syscoin", &syscoincheckmintbatch},
+        {"syscoin", &syscoingetmintfilterinfo},
+        {"syscoin", &assetallocationbalances},
+        {"syscoin", &assetallocationhistory},
+        {"syscoin", &getassetstats},
     };
     for (const auto& c : commands) {
         t.appendCommand(c.name, &c);
@@ -4,7 +4,19 @@
 
 #ifndef SYSCOIN_SERVICES_RPC_ASSETRPC_H
 #define SYSCOIN_SERVICES_RPC_ASSETRPC_H
+#include <consensus/amount.h>
+#include <optional>
 #include <string>
+#include <vector>
+class CTransaction;
+class NEVMTxRoot;
+class UniValue;
+class uint256;
+struct AssetAllocationDelta;
 bool SysTxToJSON(const CTransaction &tx, UniValue &entry);
 bool DecodeSyscoinRawtransaction(const CTransaction& rawTx, UniValue& output);
+UniValue AssetAllocationBalancesToJSON(const std::vector<std::pair<uint64_t, CAmount>>& vecBalances);
+UniValue AssetAllocationHistoryToJSON(const std::vector<AssetAllocationDelta>& vecHistory);
+UniValue NEVMTxRootsToJSON(const std::vector<uint256>& vecBlockHashes, const std::vector<std::optional<NEVMTxRoot>>& vecTxRoots);
+UniValue NEVMMintsToJSON(const std::vector<uint256>& vecTxHashes, const std::vector<bool>& vecMinted);
 #endif // SYSCOIN_SERVICES_RPC_ASSETRPC_H
@@ -40,6 +40,14 @@ static RPCHelpMan getnevmblockchaininfo()
                 {RPCResult::Type::NUM, "height", "The current NEVM blockchain height"},
                 {RPCResult::Type::STR, "commandline", "The NEVM command line parameters used to pass through to sysgeth"},
                 {RPCResult::Type::STR, "status", "The NEVM status, online or offline"},
+                {RPCResult::Type::OBJ, "blobcache", "In-memory cache of recently used NEVM blobs",
+                {
+                    {RPCResult::Type::NUM, "hits", "Blob reads served from the cache"},
+                    {RPCResult::Type::NUM, "misses", "Blob reads that went to the blob files"},
+                    {RPCResult::Type::NUM, "entries", "Number of cached blobs"},
+                    {RPCResult::Type::NUM, "bytes", "Size of the cached blobs"},
+                    {RPCResult::Type::NUM, "maxbytes", "Cache budget set by -nevmblobcache"},
+                }},
             }},
         RPCExamples{
             HelpExampleCli("getnevmblockchaininfo", "")
@@ -90,6 +98,16 @@ static RPCHelpMan getnevmblockchaininfo()
     bool bResponse = false;
     GetMainSignals().NotifyNEVMComms("status", bResponse);
     oNEVM.pushKVEnd("status", bResponse? "online": "offline");
+    if (pnevmdatablobdb) {
+        const CNEVMBlobCache::Stats cacheStats = pnevmdatablobdb->GetCacheStats();
+        UniValue oCache(UniValue::VOBJ);
+        oCache.pushKV("hits", cacheStats.nHits);
+        oCache.pushKV("misses", cacheStats.nMisses);
+        oCache.pushKV("entries", cacheStats.nEntries);
+        oCache.pushKV("bytes", cacheStats.nBytes);
+        oCache.pushKV("maxbytes", cacheStats.nMaxBytes);
+        oNEVM.pushKVEnd("blobcache", oCache);
+    }
     return oNEVM;
 },
     };
@@ -189,11 +207,11 @@ static RPCHelpMan getnevmblobdata()
         }
     }
     if(bGetData) {
-        std::vector<uint8_t> vchData;
-        if (!pnevmdatablobdb->Read(vchVH, vchData)) {
+        const auto blob = pnevmdatablobdb->ReadBlobShared(vchVH);
+        if (!blob) {
             throw JSONRPCError(RPC_INVALID_PARAMS, strprintf("Could not find data for versionhash %s", HexStr(vchVH)));
-        }       
-        oNEVM.pushKVEnd("data", HexStr(vchData));
+        }
+        oNEVM.pushKVEnd("data", HexStr(*blob));
     }
     return oNEVM;
 },
@@ -211,44 +229,18 @@ bool ScanBlobs(CNEVMDataDB& pnevmdatadb, const uint32_t count, const uint32_t fr
         }
     }
 
-    uint64_t totalSize = 0;
-    uint64_t totalBlobs = 0;
-    uint64_t oldest = UINT64_MAX;
-    uint64_t newest = 0;
     LOCK(pnevmdatadb.cs_cache);
     const PoDAMAPMemory &cache = pnevmdatadb.GetCache();
 
     if (stats) {
-        for (const auto& [key, val] : cache) {
-            totalSize += val.nSize;
-            totalBlobs++;
-            oldest = std::min(oldest, static_cast<uint64_t>(val.nMedianTime));
-            newest = std::max(newest, static_cast<uint64_t>(val.nMedianTime));         
-        }
-
-        std::unique_ptr<CDBIterator> pcursor(pnevmdatadb.NewIterator());
-        pcursor->SeekToFirst();
-        std::vector<uint8_t> vchVersionHash;
-        while (pcursor->Valid()) {
-            vchVersionHash.clear();
-            if (pcursor->GetKey(vchVersionHash)) {
-                if(cache.find(vchVersionHash) == cache.end()) {
-                    MapPoDAPayloadMeta meta;
-                    if(pcursor->GetValue(meta)) {
-                        totalSize += meta.nSize;
-                        totalBlobs++;
-                        oldest = std::min(oldest, static_cast<uint64_t>(meta.nMedianTime));
-                        newest = std::max(newest, static_cast<uint64_t>(meta.nMedianTime));    
-                    }
-                }
-            }
-            pcursor->Next();
-        }
-
+        // totals are maintained on write and the time bounds come from the ends of the time index
+        CNEVMDataStats dataStats;
+        int64_t oldest, newest;
+        pnevmdatadb.GetStats(dataStats, oldest, newest);
         UniValue oStats(UniValue::VOBJ);
-        oStats.pushKV("total_blobs", totalBlobs);
-        oStats.pushKV("total_size", totalSize);
-        oStats.pushKV("oldest_mpt", oldest == UINT64_MAX ? 0 : oldest);
+        oStats.pushKV("total_blobs", dataStats.nBlobs);
+        oStats.pushKV("total_size", dataStats.nSize);
+        oStats.pushKV("oldest_mpt", oldest);
         oStats.pushKV("newest_mpt", newest);
         oRes.push_back(oStats);
         return true;
@@ -272,20 +264,22 @@ bool ScanBlobs(CNEVMDataDB& pnevmdatadb, const uint32_t count, const uint32_t fr
     pcursor->SeekToFirst();
     std::vector<uint8_t> vchVersionHash;
     while (pcursor->Valid()) {
-        if (pcursor->GetKey(vchVersionHash)) {
-            if(cache.find(vchVersionHash) == cache.end()) {
-                if (++index <= from) { pcursor->Next(); continue; }
-                UniValue oBlob(UniValue::VOBJ);
-                MapPoDAPayloadMeta meta;
-                if(pcursor->GetValue(meta)) {
-                    oBlob.pushKV("versionhash", HexStr(vchVersionHash));
-                    oBlob.pushKV("mtp", meta.nMedianTime);
-                    oBlob.pushKV("datasize", meta.nSize);
-                    oBlob.pushKV("txid", meta.txid.ToString());
-                    oRes.push_back(oBlob);
-                }
-                if (index >= count + from) break;
+        // version hash keys sort ahead of the time index and stats records
+        if (!pcursor->GetKey(vchVersionHash)) {
+            break;
+        }
+        if(cache.find(vchVersionHash) == cache.end()) {
+            if (++index <= from) { pcursor->Next(); continue; }
+            UniValue oBlob(UniValue::VOBJ);
+            MapPoDAPayloadMeta meta;
+            if(pcursor->GetValue(meta)) {
+                oBlob.pushKV("versionhash", HexStr(vchVersionHash));
+                oBlob.pushKV("mtp", meta.nMedianTime);
+                oBlob.pushKV("datasize", meta.nSize);
+                oBlob.pushKV("txid", meta.txid.ToString());
+                oRes.push_back(oBlob);
             }
+            if (index >= count + from) break;
         }
         pcursor->Next();
     }
@@ -0,0 +1,201 @@
+// Copyright (c) 2024 The Syscoin Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <addresstype.h>
+#include <chainparams.h>
+#include <index/assetallocationindex.h>
+#include <interfaces/chain.h>
+#include <script/sign.h>
+#include <script/signingprovider.h>
+#include <test/util/index.h>
+#include <test/util/setup_common.h>
+#include <test/util/transaction_utils.h>
+#include <test/util/validation.h>
+#include <util/translation.h>
+#include <validation.h>
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(assetallocationindex_tests)
+
+BOOST_FIXTURE_TEST_CASE(assetallocationindex_initial_sync, TestChain100Setup)
+{
+    AssetAllocationIndex index{interfaces::MakeChain(m_node), 1 << 20, true};
+    BOOST_REQUIRE(index.Init());
+    BOOST_CHECK(!index.BlockUntilSyncedToCurrentChain());
+    BOOST_REQUIRE(index.StartBackgroundSync());
+    IndexWaitSynced(index);
+
+    // plain SYS outputs never show up as asset balances
+    const CScript coinbase_script{m_coinbase_txns[0]->vout[0].scriptPubKey};
+    BOOST_CHECK(index.FindBalances(coinbase_script).empty());
+
+    CreateAndProcessBlock({}, coinbase_script);
+    BOOST_CHECK(index.BlockUntilSyncedToCurrentChain());
+    BOOST_CHECK(index.FindBalances(coinbase_script).empty());
+
+    SyncWithValidationInterfaceQueue();
+    index.Stop();
+}
+
+BOOST_FIXTURE_TEST_CASE(assetallocationindex_balances, TestChainDIP3Setup)
+{
+    const uint64_t nAsset{Params().GetConsensus().nSYSXAsset};
+    AssetAllocationIndex index{interfaces::MakeChain(m_node), 1 << 20, true};
+    BOOST_REQUIRE(index.Init());
+    BOOST_REQUIRE(index.StartBackgroundSync());
+    IndexWaitSynced(index);
+
+    const CScript script_a{GetScriptForDestination(PKHash(coinbaseKey.GetPubKey()))};
+    const CScript script_b{CScript() << OP_TRUE};
+    FillableSigningProvider keystore;
+    keystore.AddKey(coinbaseKey);
+    const auto sign = [&](CMutableTransaction& mtx, const CTransaction& prev_tx) {
+        std::map<COutPoint, Coin> coins;
+        for (const CTxIn& txin : mtx.vin) {
+            coins.emplace(txin.prevout, Coin(prev_tx.vout[txin.prevout.n], 1, false));
+        }
+        std::map<int, bilingual_str> input_errors;
+        BOOST_REQUIRE(SignTransaction(mtx, &keystore, coins, SIGHASH_ALL, input_errors));
+    };
+
+    // burn SYS into 10 SYSX held by script_a, the burn output carries SYS and no allocation
+    CMutableTransaction burn;
+    burn.nVersion = SYSCOIN_TX_VERSION_SYSCOIN_BURN_TO_ALLOCATION;
+    burn.vin.emplace_back(COutPoint(m_coinbase_txns[0]->GetHash(), 0));
+    burn.vout.emplace_back(m_coinbase_txns[0]->vout[0].nValue - 11 * COIN, script_a);
+    AddAssetAllocation(burn, {CAssetOut(nAsset, {CAssetOutValue(0, 10 * COIN)})}, 10 * COIN);
+    sign(burn, *m_coinbase_txns[0]);
+    const CTransaction burn_tx{burn};
+    BOOST_REQUIRE(burn_tx.vout[1].assetInfo.IsNull());
+    CreateAndProcessBlock({burn}, script_a);
+    const int nBurnHeight{WITH_LOCK(cs_main, return m_node.chainman->ActiveHeight())};
+
+    // send 4 of them to script_b, keeping 6 as change
+    CMutableTransaction send;
+    send.nVersion = SYSCOIN_TX_VERSION_ALLOCATION_SEND;
+    send.vin.emplace_back(COutPoint(burn_tx.GetHash(), 0));
+    send.vout.emplace_back(burn_tx.vout[0].nValue - COIN - 10000, script_a);
+    send.vout.emplace_back(COIN, script_b);
+    AddAssetAllocation(send, {CAssetOut(nAsset, {CAssetOutValue(0, 6 * COIN), CAssetOutValue(1, 4 * COIN)})});
+    sign(send, burn_tx);
+    const CTransaction send_tx{send};
+    const CBlock send_block{CreateAndProcessBlock({send}, script_a)};
+    BOOST_REQUIRE(WITH_LOCK(cs_main, return m_node.chainman->ActiveTip()->GetBlockHash()) == send_block.GetHash());
+    const int nSendHeight{nBurnHeight + 1};
+    BOOST_REQUIRE(index.BlockUntilSyncedToCurrentChain());
+
+    CAmount nBalance{0};
+    BOOST_CHECK(index.FindBalance(script_a, nAsset, nBalance));
+    BOOST_CHECK_EQUAL(nBalance, 6 * COIN);
+    BOOST_CHECK(index.FindBalance(script_b, nAsset, nBalance));
+    BOOST_CHECK_EQUAL(nBalance, 4 * COIN);
+    BOOST_CHECK(!index.FindBalance(script_a, nAsset + 1, nBalance));
+    const auto vecBalances = index.FindBalances(script_a);
+    BOOST_REQUIRE_EQUAL(vecBalances.size(), 1U);
+    BOOST_CHECK_EQUAL(vecBalances[0].first, nAsset);
+    BOOST_CHECK_EQUAL(vecBalances[0].second, 6 * COIN);
+    // the allocation data output is not an address balance
+    BOOST_CHECK(index.FindBalances(burn_tx.vout[1].scriptPubKey).empty());
+
+    const auto vecHistory = index.FindHistory(script_a, nAsset, 0, MAX_ASSETALLOCATION_HISTORY);
+    BOOST_REQUIRE_EQUAL(vecHistory.size(), 2U);
+    BOOST_CHECK_EQUAL(vecHistory[0].height, nBurnHeight);
+    BOOST_CHECK(vecHistory[0].txid == burn_tx.GetHash());
+    BOOST_CHECK_EQUAL(vecHistory[0].amount, 10 * COIN);
+    BOOST_CHECK_EQUAL(vecHistory[1].height, nSendHeight);
+    BOOST_CHECK(vecHistory[1].txid == send_tx.GetHash());
+    BOOST_CHECK_EQUAL(vecHistory[1].amount, -4 * COIN);
+    BOOST_REQUIRE_EQUAL(index.FindHistory(script_a, nAsset, nSendHeight, MAX_ASSETALLOCATION_HISTORY).size(), 1U);
+    BOOST_CHECK_EQUAL(index.FindHistory(script_a, nAsset, 0, 1).size(), 1U);
+    BOOST_CHECK(index.FindHistory(script_a, nAsset, nSendHeight + 1, MAX_ASSETALLOCATION_HISTORY).empty());
+    BOOST_CHECK(index.FindHistory(script_a, nAsset, 0, 0).empty());
+
+    // a reorg that drops the send rewinds the index to the burn
+    {
+        BlockValidationState state;
+        CBlockIndex* pindex{WITH_LOCK(cs_main, return m_node.chainman->ActiveTip())};
+        BOOST_REQUIRE(m_node.chainman->ActiveChainstate().InvalidateBlock(state, pindex));
+    }
+    CreateAndProcessBlock({}, script_a);
+    BOOST_REQUIRE(index.BlockUntilSyncedToCurrentChain());
+    BOOST_CHECK(index.FindBalance(script_a, nAsset, nBalance));
+    BOOST_CHECK_EQUAL(nBalance, 10 * COIN);
+    BOOST_CHECK(!index.FindBalance(script_b, nAsset, nBalance));
+    BOOST_CHECK_EQUAL(index.FindHistory(script_a, nAsset, 0, MAX_ASSETALLOCATION_HISTORY).size(), 1U);
+    BOOST_CHECK(index.FindHistory(script_b, nAsset, 0, MAX_ASSETALLOCATION_HISTORY).empty());
+
+    SyncWithValidationInterfaceQueue();
+    index.Stop();
+}
+
+BOOST_FIXTURE_TEST_CASE(assetallocationindex_unclean_shutdown, TestChainDIP3Setup)
+{
+    Chainstate& chainstate = Assert(m_node.chainman)->ActiveChainstate();
+    const CChainParams& params = Params();
+    const uint64_t nAsset{params.GetConsensus().nSYSXAsset};
+    const CScript script_a{GetScriptForDestination(PKHash(coinbaseKey.GetPubKey()))};
+
+    // a block burning SYS into 10 SYSX held by script_a
+    CMutableTransaction burn;
+    burn.nVersion = SYSCOIN_TX_VERSION_SYSCOIN_BURN_TO_ALLOCATION;
+    burn.vin.emplace_back(COutPoint(m_coinbase_txns[0]->GetHash(), 0));
+    burn.vout.emplace_back(m_coinbase_txns[0]->vout[0].nValue - 11 * COIN, script_a);
+    AddAssetAllocation(burn, {CAssetOut(nAsset, {CAssetOutValue(0, 10 * COIN)})}, 10 * COIN);
+    FillableSigningProvider keystore;
+    keystore.AddKey(coinbaseKey);
+    std::map<COutPoint, Coin> coins;
+    coins.emplace(burn.vin[0].prevout, Coin(m_coinbase_txns[0]->vout[0], 1, false));
+    std::map<int, bilingual_str> input_errors;
+    BOOST_REQUIRE(SignTransaction(burn, &keystore, coins, SIGHASH_ALL, input_errors));
+    const auto new_block = std::make_shared<const CBlock>(CreateBlock({burn}, script_a, chainstate));
+
+    CAmount nBalance{0};
+    {
+        AssetAllocationIndex index{interfaces::MakeChain(m_node), 1 << 20};
+        BOOST_REQUIRE(index.Init());
+        BOOST_REQUIRE(index.StartBackgroundSync());
+        IndexWaitSynced(index);
+        CBlockIndex* new_block_index = nullptr;
+        {
+            LOCK(cs_main);
+            BlockValidationState state;
+            BOOST_CHECK(CheckBlock(*new_block, state, params.GetConsensus()));
+            BOOST_CHECK(m_node.chainman->AcceptBlock(new_block, state, &new_block_index, true, nullptr, nullptr, true));
+            CCoinsViewCache view(&chainstate.CoinsTip());
+            BOOST_CHECK(chainstate.ConnectBlock(*new_block, state, new_block_index, view));
+        }
+        // The block is applied but never committed as the best block, the next start must roll it back.
+        ValidationInterfaceTest::BlockConnected(ChainstateRole::NORMAL, index, new_block, new_block_index);
+        BOOST_CHECK(index.FindBalance(script_a, nAsset, nBalance));
+        BOOST_CHECK_EQUAL(nBalance, 10 * COIN);
+        BOOST_CHECK_EQUAL(index.FindHistory(script_a, nAsset, 0, MAX_ASSETALLOCATION_HISTORY).size(), 1U);
+        index.Stop();
+    }
+
+    {
+        AssetAllocationIndex index{interfaces::MakeChain(m_node), 1 << 20};
+        BOOST_REQUIRE(index.Init());
+        // the allocations of the uncommitted block are gone again
+        BOOST_CHECK(!index.FindBalance(script_a, nAsset, nBalance));
+        BOOST_CHECK(index.FindHistory(script_a, nAsset, 0, MAX_ASSETALLOCATION_HISTORY).empty());
+        BOOST_REQUIRE(index.StartBackgroundSync());
+        IndexWaitSynced(index);
+
+        // connecting the block for real counts it once
+        BOOST_REQUIRE(m_node.chainman->ProcessNewBlock(new_block, /*force_processing=*/true, /*min_pow_checked=*/true, /*new_block=*/nullptr));
+        BOOST_REQUIRE(WITH_LOCK(cs_main, return m_node.chainman->ActiveTip()->GetBlockHash()) == new_block->GetHash());
+        BOOST_REQUIRE(index.BlockUntilSyncedToCurrentChain());
+        BOOST_CHECK(index.FindBalance(script_a, nAsset, nBalance));
+        BOOST_CHECK_EQUAL(nBalance, 10 * COIN);
+        const auto vecHistory = index.FindHistory(script_a, nAsset, 0, MAX_ASSETALLOCATION_HISTORY);
+        BOOST_REQUIRE_EQUAL(vecHistory.size(), 1U);
+        BOOST_CHECK(vecHistory[0].txid == burn.GetHash());
+        BOOST_CHECK_EQUAL(vecHistory[0].amount, 10 * COIN);
+        SyncWithValidationInterfaceQueue();
+        index.Stop();
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
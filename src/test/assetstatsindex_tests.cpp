@@ -0,0 +1,180 @@
+// Copyright (c) 2024 The Syscoin Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <addresstype.h>
+#include <chainparams.h>
+#include <index/assetstatsindex.h>
+#include <interfaces/chain.h>
+#include <script/sign.h>
+#include <script/signingprovider.h>
+#include <test/util/index.h>
+#include <test/util/setup_common.h>
+#include <test/util/transaction_utils.h>
+#include <test/util/validation.h>
+#include <util/translation.h>
+#include <validation.h>
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(assetstatsindex_tests)
+
+BOOST_FIXTURE_TEST_CASE(assetstatsindex_initial_sync, TestChain100Setup)
+{
+    const uint64_t nAsset{Params().GetConsensus().nSYSXAsset};
+    AssetStatsIndex index{interfaces::MakeChain(m_node), 1 << 20, true};
+    BOOST_REQUIRE(index.Init());
+    BOOST_CHECK(!index.BlockUntilSyncedToCurrentChain());
+    BOOST_REQUIRE(index.StartBackgroundSync());
+    IndexWaitSynced(index);
+
+    // plain SYS blocks never create asset totals
+    BOOST_CHECK(!index.LookUpStats(nAsset, WITH_LOCK(cs_main, return m_node.chainman->ActiveHeight())));
+    BOOST_CHECK(!index.LookUpStats(nAsset, -1));
+
+    SyncWithValidationInterfaceQueue();
+    index.Stop();
+}
+
+BOOST_FIXTURE_TEST_CASE(assetstatsindex_totals, TestChainDIP3Setup)
+{
+    const uint64_t nAsset{Params().GetConsensus().nSYSXAsset};
+    AssetStatsIndex index{interfaces::MakeChain(m_node), 1 << 20, true};
+    BOOST_REQUIRE(index.Init());
+    BOOST_REQUIRE(index.StartBackgroundSync());
+    IndexWaitSynced(index);
+
+    const CScript script_a{GetScriptForDestination(PKHash(coinbaseKey.GetPubKey()))};
+    const CScript script_b{GetScriptForDestination(WitnessV0KeyHash(coinbaseKey.GetPubKey()))};
+    FillableSigningProvider keystore;
+    keystore.AddKey(coinbaseKey);
+    const auto sign = [&](CMutableTransaction& mtx, const CTransaction& prev_tx) {
+        std::map<COutPoint, Coin> coins;
+        for (const CTxIn& txin : mtx.vin) {
+            coins.emplace(txin.prevout, Coin(prev_tx.vout[txin.prevout.n], 1, false));
+        }
+        std::map<int, bilingual_str> input_errors;
+        BOOST_REQUIRE(SignTransaction(mtx, &keystore, coins, SIGHASH_ALL, input_errors));
+    };
+    const auto tip_height = [&] { return WITH_LOCK(cs_main, return m_node.chainman->ActiveHeight()); };
+
+    // burning SYS mints 10 SYSX held by script_a
+    CMutableTransaction burn;
+    burn.nVersion = SYSCOIN_TX_VERSION_SYSCOIN_BURN_TO_ALLOCATION;
+    burn.vin.emplace_back(COutPoint(m_coinbase_txns[0]->GetHash(), 0));
+    burn.vout.emplace_back(m_coinbase_txns[0]->vout[0].nValue - 11 * COIN, script_a);
+    AddAssetAllocation(burn, {CAssetOut(nAsset, {CAssetOutValue(0, 10 * COIN)})}, 10 * COIN);
+    sign(burn, *m_coinbase_txns[0]);
+    const CTransaction burn_tx{burn};
+    CreateAndProcessBlock({burn}, script_a);
+    const int nBurnHeight{tip_height()};
+
+    // 4 of them move to script_b
+    CMutableTransaction send;
+    send.nVersion = SYSCOIN_TX_VERSION_ALLOCATION_SEND;
+    send.vin.emplace_back(COutPoint(burn_tx.GetHash(), 0));
+    send.vout.emplace_back(burn_tx.vout[0].nValue - COIN - 10000, script_a);
+    send.vout.emplace_back(COIN, script_b);
+    AddAssetAllocation(send, {CAssetOut(nAsset, {CAssetOutValue(0, 6 * COIN), CAssetOutValue(1, 4 * COIN)})});
+    sign(send, burn_tx);
+    const CTransaction send_tx{send};
+    CreateAndProcessBlock({send}, script_a);
+    const int nSendHeight{tip_height()};
+
+    // and script_b burns them back to SYS, the allocation ends up on the unspendable data output
+    CMutableTransaction unburn;
+    unburn.nVersion = SYSCOIN_TX_VERSION_ALLOCATION_BURN_TO_SYSCOIN;
+    unburn.vin.emplace_back(COutPoint(send_tx.GetHash(), 1));
+    unburn.vout.emplace_back(4 * COIN, script_b);
+    unburn.vout.emplace_back(COIN - 10000, script_b);
+    AddAssetAllocation(unburn, {CAssetOut(nAsset, {CAssetOutValue(2, 4 * COIN)})});
+    sign(unburn, send_tx);
+    const CBlock unburn_block{CreateAndProcessBlock({unburn}, script_a)};
+    const int nUnburnHeight{tip_height()};
+    BOOST_REQUIRE_EQUAL(nUnburnHeight, nBurnHeight + 2);
+    BOOST_REQUIRE(unburn_block.vtx.size() == 2);
+    BOOST_REQUIRE(index.BlockUntilSyncedToCurrentChain());
+
+    const auto minted = index.LookUpStats(nAsset, nBurnHeight);
+    BOOST_REQUIRE(minted);
+    BOOST_CHECK_EQUAL(minted->height, nBurnHeight);
+    BOOST_CHECK_EQUAL(minted->supply, 10 * COIN);
+    BOOST_CHECK_EQUAL(minted->minted, 10 * COIN);
+    BOOST_CHECK_EQUAL(minted->burned, 0);
+    BOOST_CHECK_EQUAL(minted->holders, 1U);
+    const auto sent = index.LookUpStats(nAsset, nSendHeight);
+    BOOST_REQUIRE(sent);
+    BOOST_CHECK_EQUAL(sent->supply, 10 * COIN);
+    BOOST_CHECK_EQUAL(sent->minted, 10 * COIN);
+    BOOST_CHECK_EQUAL(sent->holders, 2U);
+    const auto burned = index.LookUpStats(nAsset, nUnburnHeight);
+    BOOST_REQUIRE(burned);
+    BOOST_CHECK_EQUAL(burned->height, nUnburnHeight);
+    BOOST_CHECK_EQUAL(burned->supply, 6 * COIN);
+    BOOST_CHECK_EQUAL(burned->minted, 10 * COIN);
+    BOOST_CHECK_EQUAL(burned->burned, 4 * COIN);
+    BOOST_CHECK_EQUAL(burned->holders, 1U);
+    // the snapshot stays in effect until the next block that changes the asset
+    const auto later = index.LookUpStats(nAsset, nUnburnHeight + 10);
+    BOOST_REQUIRE(later);
+    BOOST_CHECK_EQUAL(later->height, nUnburnHeight);
+    BOOST_CHECK(!index.LookUpStats(nAsset, nBurnHeight - 1));
+    BOOST_CHECK(!index.LookUpStats(nAsset + 1, nUnburnHeight));
+
+    // a reorg that drops the burn back to SYS rewinds the totals to the send
+    {
+        BlockValidationState state;
+        CBlockIndex* pindex{WITH_LOCK(cs_main, return m_node.chainman->ActiveTip())};
+        BOOST_REQUIRE(m_node.chainman->ActiveChainstate().InvalidateBlock(state, pindex));
+    }
+    CreateAndProcessBlock({}, script_a);
+    BOOST_REQUIRE(index.BlockUntilSyncedToCurrentChain());
+    const auto rewound = index.LookUpStats(nAsset, nUnburnHeight);
+    BOOST_REQUIRE(rewound);
+    BOOST_CHECK_EQUAL(rewound->height, nSendHeight);
+    BOOST_CHECK_EQUAL(rewound->supply, 10 * COIN);
+    BOOST_CHECK_EQUAL(rewound->burned, 0);
+    BOOST_CHECK_EQUAL(rewound->holders, 2U);
+
+    SyncWithValidationInterfaceQueue();
+    index.Stop();
+}
+
+BOOST_FIXTURE_TEST_CASE(assetstatsindex_unclean_shutdown, TestChain100Setup)
+{
+    Chainstate& chainstate = Assert(m_node.chainman)->ActiveChainstate();
+    const CChainParams& params = Params();
+    {
+        AssetStatsIndex index{interfaces::MakeChain(m_node), 1 << 20};
+        BOOST_REQUIRE(index.Init());
+        BOOST_REQUIRE(index.StartBackgroundSync());
+        IndexWaitSynced(index);
+        std::shared_ptr<const CBlock> new_block;
+        CBlockIndex* new_block_index = nullptr;
+        {
+            const CScript script_pub_key{CScript() << ToByteVector(coinbaseKey.GetPubKey()) << OP_CHECKSIG};
+            const CBlock block = this->CreateBlock({}, script_pub_key, chainstate);
+
+            new_block = std::make_shared<CBlock>(block);
+
+            LOCK(cs_main);
+            BlockValidationState state;
+            BOOST_CHECK(CheckBlock(block, state, params.GetConsensus()));
+            BOOST_CHECK(m_node.chainman->AcceptBlock(new_block, state, &new_block_index, true, nullptr, nullptr, true));
+            CCoinsViewCache view(&chainstate.CoinsTip());
+            BOOST_CHECK(chainstate.ConnectBlock(block, state, new_block_index, view));
+        }
+        // The block is applied but never committed as the best block, the next start must roll it back.
+        ValidationInterfaceTest::BlockConnected(ChainstateRole::NORMAL, index, new_block, new_block_index);
+        index.Stop();
+    }
+
+    {
+        AssetStatsIndex index{interfaces::MakeChain(m_node), 1 << 20};
+        BOOST_REQUIRE(index.Init());
+        BOOST_REQUIRE(index.StartBackgroundSync());
+        index.Stop();
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -5,7 +5,9 @@
 #include <blockencodings.h>
 #include <chainparams.h>
 #include <consensus/merkle.h>
+#include <nevm/sha3.h>
 #include <pow.h>
+#include <services/nevmconsensus.h>
 #include <streams.h>
 #include <test/util/random.h>
 #include <test/util/txmempool.h>
@@ -122,6 +124,7 @@ public:
     std::vector<PrefilledTransaction> prefilledtxn;
     // SYSCOIN
     std::vector<unsigned char> vchNEVMBlockData;
+    std::vector<NEVMDataRef> nevmdatarefs;
     explicit TestHeaderAndShortIDs(const CBlockHeaderAndShortTxIDs& orig) {
         CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
         stream << orig;
@@ -138,7 +141,13 @@ public:
         return base.GetShortID(txhash);
     }
     // SYSCOIN
-    SERIALIZE_METHODS(TestHeaderAndShortIDs, obj) { READWRITE(obj.header, obj.nonce, Using<VectorFormatter<CustomUintFormatter<CBlockHeaderAndShortTxIDs::SHORTTXIDS_LENGTH>>>(obj.shorttxids), obj.prefilledtxn, obj.vchNEVMBlockData); }
+    SERIALIZE_METHODS(TestHeaderAndShortIDs, obj)
+    {
+        READWRITE(obj.header, obj.nonce, Using<VectorFormatter<CustomUintFormatter<CBlockHeaderAndShortTxIDs::SHORTTXIDS_LENGTH>>>(obj.shorttxids), obj.prefilledtxn, obj.vchNEVMBlockData);
+        if (s.GetVersion() >= PODA_COMPACT_BLOCKS_VERSION) {
+            READWRITE(obj.nevmdatarefs);
+        }
+    }
 };
 
 BOOST_AUTO_TEST_CASE(NonCoinbasePreforwardRTTest)
@@ -306,6 +315,97 @@ BOOST_AUTO_TEST_CASE(EmptyBlockRoundTripTest)
     }
 }
 
+BOOST_AUTO_TEST_CASE(NEVMDataStrippedRoundTripTest)
+{
+    CTxMemPool& pool = *Assert(m_node.mempool);
+    pnevmdatablobdb = std::make_unique<CNEVMDataBlobDB>(DBParams{
+        .path = "poda_blob",
+        .cache_bytes = static_cast<size_t>(1 << 20),
+        .memory_only = true,
+        .wipe_data = true});
+    const std::vector<uint8_t> data(1000, 0x42);
+    CNEVMData nevmData;
+    nevmData.vchVersionHash = dev::sha3(data).asBytes();
+    std::vector<unsigned char> payload;
+    nevmData.SerializeData(payload);
+
+    CMutableTransaction coinbase;
+    coinbase.vin.resize(1);
+    coinbase.vin[0].scriptSig.resize(10);
+    coinbase.vout.resize(1);
+    coinbase.vout[0].nValue = 42;
+    CMutableTransaction blobtx;
+    blobtx.nVersion = SYSCOIN_TX_VERSION_NEVM_DATA_SHA3;
+    blobtx.vin.resize(1);
+    blobtx.vin[0].prevout.hash = InsecureRand256();
+    blobtx.vout.emplace_back(0, CScript() << OP_RETURN << payload);
+    blobtx.vout.back().vchNEVMData = data;
+
+    CBlock block;
+    block.vtx.emplace_back(MakeTransactionRef(std::move(coinbase)));
+    block.vtx.emplace_back(MakeTransactionRef(std::move(blobtx)));
+    SetBlockVersion(block, 42);
+    block.hashPrevBlock = InsecureRand256();
+    block.nBits = 0x207fffff;
+    bool mutated;
+    block.hashMerkleRoot = BlockMerkleRoot(block, &mutated);
+    assert(!mutated);
+    while (!CheckProofOfWork(block.GetHash(), block.nBits, Params().GetConsensus())) ++block.nNonce;
+
+    PoDAMAPMemory mapBlobs;
+    MapPoDAPayloadMeta meta{block.vtx[1]->GetHash(), static_cast<uint32_t>(data.size()), 0};
+    meta.vchNEVMData = std::make_shared<const std::vector<uint8_t>>(data);
+    mapBlobs.try_emplace(nevmData.vchVersionHash, meta);
+    BOOST_REQUIRE(pnevmdatablobdb->WriteBlobs(mapBlobs));
+
+    CBlockHeaderAndShortTxIDs shortIDs{block};
+    BOOST_REQUIRE_EQUAL(shortIDs.nevmdatarefs.size(), 1U);
+    BOOST_CHECK_EQUAL(shortIDs.nevmdatarefs[0].index, 1U);
+
+    // peers before PODA_COMPACT_BLOCKS_VERSION do not see the version hashes
+    {
+        CDataStream stream(SER_NETWORK, PODA_COMPACT_BLOCKS_VERSION - 1);
+        stream << shortIDs;
+        CBlockHeaderAndShortTxIDs shortIDs2;
+        stream >> shortIDs2;
+        BOOST_CHECK(shortIDs2.nevmdatarefs.empty());
+    }
+
+    CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
+    stream << shortIDs;
+    CBlockHeaderAndShortTxIDs shortIDs2;
+    stream >> shortIDs2;
+
+    PartiallyDownloadedBlock partialBlock(&pool);
+    partialBlock.m_check_block_mock = [](const CBlock&, BlockValidationState&, const Consensus::Params&, bool, bool) { return true; };
+    BOOST_CHECK(partialBlock.InitData(shortIDs2, extra_txn) == READ_STATUS_OK);
+    BOOST_CHECK(!partialBlock.IsTxAvailable(1));
+    BOOST_CHECK(partialBlock.IsBlobAvailable(1));
+
+    // the transaction is sent without its blob and rebuilt from the blob store
+    const std::vector<CTransactionRef> vtx_missing{StripNEVMData(block.vtx[1])};
+    BOOST_CHECK(vtx_missing[0]->vout[0].vchNEVMData.empty());
+    BOOST_CHECK(vtx_missing[0]->GetWitnessHash() == block.vtx[1]->GetWitnessHash());
+    CBlock block2;
+    BOOST_CHECK(partialBlock.FillBlock(block2, vtx_missing) == READ_STATUS_OK);
+    BOOST_CHECK_EQUAL(block.GetHash().ToString(), block2.GetHash().ToString());
+    BOOST_CHECK(block2.vtx[1]->vout[0].vchNEVMData == data);
+
+    // a block read without its blobs streams them in and goes out exactly like the filled block
+    CBlock stripped{block};
+    stripped.vtx[1] = StripNEVMData(block.vtx[1]);
+    CBlockWithNEVMData blockWithData{stripped};
+    BOOST_REQUIRE(blockWithData.Load());
+    for (const int nFlags : {0, SERIALIZE_TRANSACTION_NO_WITNESS}) {
+        CDataStream expected(SER_NETWORK, PROTOCOL_VERSION | nFlags);
+        expected << block;
+        CDataStream streamed(SER_NETWORK, PROTOCOL_VERSION | nFlags);
+        streamed << blockWithData;
+        BOOST_CHECK_EQUAL(HexStr(expected), HexStr(streamed));
+    }
+    pnevmdatablobdb.reset();
+}
+
 BOOST_AUTO_TEST_CASE(TransactionsRequestSerializationTest) {
     BlockTransactionsRequest req1;
     req1.blockhash = InsecureRand256();
@@ -315,7 +415,7 @@ BOOST_AUTO_TEST_CASE(TransactionsRequestSerializationTest) {
     req1.indexes[2] = 3;
     req1.indexes[3] = 4;
 
-    DataStream stream{};
+    CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
     stream << req1;
 
     BlockTransactionsRequest req2;
@@ -335,7 +435,7 @@ BOOST_AUTO_TEST_CASE(TransactionsRequestDeserializationMaxTest) {
     req0.blockhash = InsecureRand256();
     req0.indexes.resize(1);
     req0.indexes[0] = 0xffff;
-    DataStream stream{};
+    CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
     stream << req0;
 
     BlockTransactionsRequest req1;
@@ -355,7 +455,7 @@ BOOST_AUTO_TEST_CASE(TransactionsRequestDeserializationOverflowTest) {
     req0.indexes[0] = 0x7000;
     req0.indexes[1] = 0x10000 - 0x7000 - 2;
     req0.indexes[2] = 0;
-    DataStream stream{};
+    CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
     stream << req0.blockhash;
     WriteCompactSize(stream, req0.indexes.size());
     WriteCompactSize(stream, req0.indexes[0]);
@@ -4,6 +4,7 @@
 
 #include <bls/bls.h>
 #include <bls/bls_batchverifier.h>
+#include <bls/bls_worker.h>
 #include <clientversion.h>
 #include <random.h>
 #include <streams.h>
@@ -13,6 +14,7 @@
 
 #include <array>
 #include <atomic>
+#include <set>
 #include <thread>
 #include <vector>
 
@@ -365,6 +367,16 @@ void FuncBatchVerifier(const bool legacy_scheme)
     // last message invalid from one source
     AddMessage(msgs, 1, 7, 1, false);
     Verify(msgs);
+
+    msgs.clear();
+    // bad sources and messages isolated among many valid ones
+    for (uint32_t i = 1; i <= 16; ++i) {
+        AddMessage(msgs, i, i, i, i != 5 && i != 12);
+    }
+    AddMessage(msgs, 3, 17, 17, true);
+    AddMessage(msgs, 3, 18, 18, false);
+    AddMessage(msgs, 3, 19, 19, true);
+    Verify(msgs);
 }
 
 void FuncThresholdSignature(const bool legacy_scheme)
@@ -471,6 +483,47 @@ BOOST_AUTO_TEST_CASE(batch_verifier_tests)
     FuncBatchVerifier(false);
 }
 
+// Verifiers handed to the worker pool each find their own bad sources, and an unstarted worker verifies inline
+static void FuncAsyncVerifyBatch(CBLSWorker& worker)
+{
+    constexpr uint32_t NUM_VERIFIERS{4};
+    std::vector<CBLSBatchVerifier<uint32_t, uint32_t>> batchVerifiers;
+    batchVerifiers.reserve(NUM_VERIFIERS);
+    std::vector<Message> msgs;
+    for (uint32_t i = 0; i < NUM_VERIFIERS; ++i) {
+        auto& batchVerifier = batchVerifiers.emplace_back(false, false);
+        for (uint32_t j = 0; j < 8; ++j) {
+            const uint32_t sourceId{i * 100 + j % 3};
+            // the second source of verifier 2 sends one bad sig
+            const bool valid{!(i == 2 && j == 4)};
+            AddMessage(msgs, sourceId, i * 100 + j, static_cast<uint8_t>(i * 8 + j), valid);
+            const auto& m = msgs.back();
+            batchVerifier.PushMessage(m.sourceId, m.msgId, m.msgHash, m.sig, m.pk);
+        }
+    }
+
+    std::vector<std::future<void>> futures;
+    for (auto& batchVerifier : batchVerifiers) {
+        futures.emplace_back(worker.AsyncVerifyBatch(batchVerifier));
+    }
+    for (auto& future : futures) {
+        future.get();
+    }
+    for (uint32_t i = 0; i < NUM_VERIFIERS; ++i) {
+        BOOST_CHECK(batchVerifiers[i].badSources == (i == 2 ? std::set<uint32_t>{201} : std::set<uint32_t>{}));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(bls_worker_async_verify_batch)
+{
+    bls::bls_legacy_scheme.store(false);
+    CBLSWorker worker;
+    FuncAsyncVerifyBatch(worker);
+    worker.Start();
+    FuncAsyncVerifyBatch(worker);
+    worker.Stop();
+}
+
 BOOST_AUTO_TEST_CASE(bls_threshold_signature_tests)
 {
     FuncThresholdSignature(true);
@@ -15,6 +15,8 @@
 #include <crypto/sha3.h>
 #include <crypto/sha512.h>
 #include <crypto/muhash.h>
+#include <crypto/multihash.h>
+#include <nevm/sha3.h>
 #include <random.h>
 #include <streams.h>
 #include <test/util/random.h>
@@ -1076,6 +1078,32 @@ BOOST_AUTO_TEST_CASE(sha256d64)
     }
 }
 
+// SYSCOIN
+BOOST_AUTO_TEST_CASE(multihash_blob_tests)
+{
+    // Random lengths around the Keccak (136 byte) and BLAKE2s (64 byte) block sizes, more inputs than the widest kernel has lanes.
+    std::vector<std::vector<unsigned char>> messages;
+    for (int i = 0; i < 37; ++i) {
+        messages.push_back(g_insecure_rand_ctx.randbytes(i < 5 ? i * 64 : InsecureRandRange(4 * 136 + 1)));
+    }
+    std::vector<Span<const unsigned char>> inputs(messages.begin(), messages.end());
+    std::vector<unsigned char> keccak(32 * inputs.size()), blake2s(32 * inputs.size());
+    for (const auto use_implementation : {multihash_implementation::STANDARD, multihash_implementation::USE_AVX2, multihash_implementation::USE_ALL}) {
+        MultiHashAutoDetect(use_implementation);
+        for (size_t count : {size_t{0}, size_t{1}, size_t{3}, inputs.size()}) {
+            Keccak256Multi(keccak.data(), inputs.data(), count);
+            Blake2s256Multi(blake2s.data(), inputs.data(), count);
+            for (size_t i = 0; i < count; ++i) {
+                const auto expected_keccak = dev::sha3(messages[i]).asBytes();
+                const auto expected_blake2s = dev::blake2s(dev::bytesConstRef(&messages[i])).asBytes();
+                BOOST_CHECK(std::equal(expected_keccak.begin(), expected_keccak.end(), keccak.begin() + 32 * i));
+                BOOST_CHECK(std::equal(expected_blake2s.begin(), expected_blake2s.end(), blake2s.begin() + 32 * i));
+            }
+        }
+    }
+    MultiHashAutoDetect();
+}
+
 static void TestSHA3_256(const std::string& input, const std::string& output)
 {
     const auto in_bytes = ParseHex(input);
@@ -0,0 +1,68 @@
+#include <string>
+namespace json_tests{
+static const std::string nevmspv_valid = R"json(
+[
+  ["The following are nevm spv proof valid samples."],
+	["Objects with a single string are ignored in the test case and is used to indicate the txid of the data source"],
+  ["spvproof"],
+	["a0e0653fb13c97c1b64a2ac57ec337f4fdd58bbdf6e85b3ef10836ce85b1b4b230","f905e0f90131a02161bbe0a12ec3f3ef5dfbf22c0a2af9710737d4ddf027a8b433e67869bf7641a05a8fedecca981699375a22d7babcd2ccb6783e5e0ecc6dacb18f8e54387aada7a02a545630b35899a7feaeeb76b7edbf54cf75eb6cae7bda0568af74ad605d2a9ea0017861bcc299448915e68aee90ca7d56a5b9bb1e08c5830474eedc734be24f23a089accf9b2fa511b6c496b5a3457d850784cb8443f04b3bf39e406a1c461a6bbda092211596ada2cca557dd432ad170863169f19d90ef8e8c12cdd0a35249d63a7aa0951b186e2e07fe4619740fc6033dfcb759739c52c17ba4ab20c061cfe14428c4a0f6b3348d8f0f6d047bdb516d328a74a2d12192881899b238664850e9e36b4acea0f6e740d77c72742567009b694c2d70f843697f4945aa5714feeaf84f16afd8748080808080808080f901f180a00c550d1003baae82be01b3506c7c08b3d770354c4d06fde621970044ed31c67ca062ba5ab22a33e9290afa38777a6d01f3cf93b19ab46dbb1088cb6051122f46a7a08a87e8dbef3ba52bbeb80cbde58ec987eb05f8192caa42ab2e41424237a46abfa0dc4516674da99afb78dc3dcb1cd47de792706c14e58435cb9e7267a81802ae04a0919455ef7bd9d58e394c13bea7ec0287ccd1a429368133b43f8e7dddd1fabf7ca09cb488c3006285e7415cb82e4ad4997492cfe83454b02b63ec72a1b20546d806a06816792b5a84a4f2b2f7ccf72cdb84960862f3fe168af4daedc32c0908dc0d46a07cfeb528481702a2faebfc9383d79a8926d530f7238a02904ccf3f08d916bbeaa03f400897d6c8a40caae136ba479140e4df681158b7c04a1f7d0fc8d4f9f4e610a03c328b1ca60b809a9a9259b8115892d8eb7a2f980fd72c6e51703aa63d80c063a02c1da46c1bcc0f764d65c1a00a7159bf82e5f4958873ba78273730f0175b08f6a04c84eb91675a586aa557591d67ac40ecb31fa4ded320adace9bb4a773806f9c8a05ec874e0243dd0f17ce1dc75472265a36f209241cfdf6f6d41d8dfdcd1a10646a0928d67cbb5dc73d712217717117f40e97d7b507f76350b09c0f0c1ef88e1f6aea03237907eccf33358ecd9e70531cdac339a768ec1bf9b44d49a990e081003b20c80f902b520b902b1f902ae8322f2348504a817c80083061a80942a0c0dbecc7e4d658f48e01e3fa353f44050c20880b90244ef343588000000000000000000000000000000000000000000000000042bb6de2f37ed740000000000000000000000000000000000000000000000b56cfa9026c2d014e2000000000000000000000000000000000000000000000000000000000000271000000000000000000000000000000000000000000000000000000004f2ed303b000000000000000000000000000000000000000000000000042bb6de2f37ed74000000000000000000000000000000000000000000000000000000000000000500000000000000000000000000000000000000000000000000038d7ea4c6800000000000000000000000000000000000000000000000000000395891247fb1600000000000000000000000000000000000000000000000000000000000000000000000000000000000000000905e337c6c8645263d3521205aa37bf4d034e74500000000000000000000000078c8f089c9144095a68a7d5cacddc94709bcff01000000000000000000000000568f954b32ed7ec83fbb557012526941cfdf805f000000000000000000000000000000000000000000000000000000000000001c000000000000000000000000000000000000000000000000000000000000001b836a5cb471bad788edbe9df8186ad60cab9c77f43da321ae2fc11d57f9699af43e2b3897e1b9589d85475a2b19324277ac598a477b6eaa60e7c43ad89ce1685103ad79270e959e2b3d4ee71128f176aec0b861f59d1562214f23676e431124cf35a9cdd69e56291f35b36c86da43100b5e21abb74c20c5ce00f4c9b59b5fb0bf26a0a9184f8509d5212625d303a6c0c31f710889cea0c56773c31d4b6cb12738c720a01d57a51a568dfa39d31bb285a327af4345e793552c57706767a25cb5a2cb439d","f902ae8322f2348504a817c80083061a80942a0c0dbecc7e4d658f48e01e3fa353f44050c20880b90244ef343588000000000000000000000000000000000000000000000000042bb6de2f37ed740000000000000000000000000000000000000000000000b56cfa9026c2d014e2000000000000000000000000000000000000000000000000000000000000271000000000000000000000000000000000000000000000000000000004f2ed303b000000000000000000000000000000000000000000000000042bb6de2f37ed74000000000000000000000000000000000000000000000000000000000000000500000000000000000000000000000000000000000000000000038d7ea4c6800000000000000000000000000000000000000000000000000000395891247fb1600000000000000000000000000000000000000000000000000000000000000000000000000000000000000000905e337c6c8645263d3521205aa37bf4d034e74500000000000000000000000078c8f089c9144095a68a7d5cacddc94709bcff01000000000000000000000000568f954b32ed7ec83fbb557012526941cfdf805f000000000000000000000000000000000000000000000000000000000000001c000000000000000000000000000000000000000000000000000000000000001b836a5cb471bad788edbe9df8186ad60cab9c77f43da321ae2fc11d57f9699af43e2b3897e1b9589d85475a2b19324277ac598a477b6eaa60e7c43ad89ce1685103ad79270e959e2b3d4ee71128f176aec0b861f59d1562214f23676e431124cf35a9cdd69e56291f35b36c86da43100b5e21abb74c20c5ce00f4c9b59b5fb0bf26a0a9184f8509d5212625d303a6c0c31f710889cea0c56773c31d4b6cb12738c720a01d57a51a568dfa39d31bb285a327af4345e793552c57706767a25cb5a2cb439d","0a"],
+  ["a0a6204bb80f67dc0e740514aef7ccf411c0f30d29b795b1eaa6366c0568c07c6e","f901d1f901ce822080b901c802f901c401826cadb9010000000000000000000000000000000000000000000000000000000000000000000800000000000000000000000000000000000000000008000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000400000000000000000008000000000000000000000000000000000000000000000000000000000000000000000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000100000000f8bbf8b994a738a563f9ecb55e0b2245d1e9e380f0fe455ea1e1a07ca654cf9212e4c3cf0164a529dd6159fc71113f867d0b09fdeb10aa65780732b880000000000000000000000000000000000000000000000000000000000001e240000000000000000000000000bf76b51ddfbe584b92d039c95f6444fabc8956a60000000000000000000000000000000000000000000000000de0b6b3a76400000000000000000000000000000000000000000000000000000000000800000012","f901c401826cadb9010000000000000000000000000000000000000000000000000000000000000000000800000000000000000000000000000000000000000008000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000400000000000000000008000000000000000000000000000000000000000000000000000000000000000000000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000100000000f8bbf8b994a738a563f9ecb55e0b2245d1e9e380f0fe455ea1e1a07ca654cf9212e4c3cf0164a529dd6159fc71113f867d0b09fdeb10aa65780732b880000000000000000000000000000000000000000000000000000000000001e240000000000000000000000000bf76b51ddfbe584b92d039c95f6444fabc8956a60000000000000000000000000000000000000000000000000de0b6b3a76400000000000000000000000000000000000000000000000000000000000800000012","80"],
+  ["spvproof1"],
+  ["0xb53f752216120e8cbe18783f41c6d960254ad59fac16229d4eaec5f7591319de"],
+  ["a076de858022a0904dbc0d6ed58f42423abe3b3ced468f81636d52c74d2186efa3","f90106f891a0e689a95524285e09f8ecc6b54109f1b8bacf8f3620a27bbb5f8a423be160e343a0f58ed79964e37302cf24967ee7177f1b8f703eb3adbc6f50fa42e56c12db8caca052d1f0f14af906e982f194b621f4cd8e6b8a78199e9489ff2e45bdfc5ec988258080808080a01e51b4181e4ab8bbb9b0807d875c8d9113443595334f34b773b6b3c2128d1ac28080808080808080f87130b86ef86c80850df847580082520894b56d622ddf60ec532b5f43b4ff9b0e7b1ff92db3883782dace9d9000008025a03c76c52993d9519cbcff2abeed7c1a62f81d83072fd0b6c245e6138e6088d313a0674e59dd82cfe38e1ae326796060df3fb776e890508a80343b1d98f3a70dab41","f86c80850df847580082520894b56d622ddf60ec532b5f43b4ff9b0e7b1ff92db3883782dace9d9000008025a03c76c52993d9519cbcff2abeed7c1a62f81d83072fd0b6c245e6138e6088d313a0674e59dd82cfe38e1ae326796060df3fb776e890508a80343b1d98f3a70dab41","80"],
+  ["spvproof2"],
+  ["0xc55e2b90168af6972193c1f86fa4d7d7b31a29c156665d15b9cd48618b5177ef"],
+  ["a0b31f174d27b99cdae8e746bd138a01ce60d8dd7b224f7c60845914def05ecc58","f87af878822080b873f8718301efc58506fc23ac008305161594104994f45d9d697ca104e5704a7b77d7fec3537c890821878651a4d70000801ba051222d91a379452395d0abaff981af4cfcc242f25cfaf947dea8245a477731f9a03a997c910b4701cca5d933fb26064ee5af7fe3236ff0ef2b58aa50b25aff8ca5","f8718301efc58506fc23ac008305161594104994f45d9d697ca104e5704a7b77d7fec3537c890821878651a4d70000801ba051222d91a379452395d0abaff981af4cfcc242f25cfaf947dea8245a477731f9a03a997c910b4701cca5d933fb26064ee5af7fe3236ff0ef2b58aa50b25aff8ca5","80"],
+  ["spvproof3"],
+  ["0x299a93acf5b100336455ef6ecda39e22329fb750e6264c8ee44f579947349de9"],
+  ["a018f2a30bb2c4d0818a253d287ed8c1defd65d6d3bcf47cc355b4fcf6b17ecf46", "f902bcf851a03b336aa1f6c6cd88d2e78561a6e35b062f0d4faa8295b3dd4fd4082aae9be2de80808080808080a0d80e62fbbacd9b1a058d7262f1c5aac18694f4fb5fa3e79ee94305a166872af28080808080808080f901f180a091e4ed9ce5f63c94b54394f2e8fece56fb5440c21da2a799903b51ec04c120e1a010d1557be630665cf06036f489691157d8813cef4977e0939db3b961a942bc26a0680b47dfd75a4578d48cc3d4f1b7765963f41bafb80df5556d3c4d76798515b9a0867e5b6a34a7351d91dc0d197bc8737251b390b332baf52b99d3786c97c5a960a001e54bccc835f610cc38142020aab5a0dfc9022ccb740f19d3b5a24cfcb75ec0a01e6b5a6184e5b86ee2805a426794ec39785ee432f9b4b930e97979d67634e2cca06dcf843b88a8d3d7bf3589b53ff0f5d06151fac071dc8ecf8acb7f3be76ad0e6a0c8fa4fda40dff8a1e835a2a546ce4c3fedc0818f67715b73e9f7e20233d6cddca0a07e2d25e54d11c83efd869d20c090887f5257b57005d03a8ea005443d136dd6a0be3c61e0830713f157a019b126053c57224eb4328255a078306ead2c702efeefa0bae76624a2b82df6febd4e8b8d77f0b5ed56cb150abe7e2a9a62a9af77e4ef79a0d39cf188518803816c447fd4e30359d2cce588a28f7c8f5954f09c1e6cbff6eba06e94fc7fca3bff828b7084113ab468c9c232e5301dd20910efdb4e799786bc74a0001fefa4fdaa1cbaf4ebf977142c4135d75bc351593977fe65461e1a3f49d6b6a0e015753585040da47bc60e995a240f1ba05c4f800f847d0e4cb65ab9f87fe30f80f87320b870f86e8324102184ee6b280082c3509446ecb5055c82b399e0ccc2cb53e36db2b366727e8802cdf679294e1c608026a009604361a8c7575d40d4285cb74d342d2c7717942222f991adb82272039d21caa06254f7e45bfda5fd1cb3559dc56fb2c5e3d21de04c3012fea73eb4d4a714d159", "f86e8324102184ee6b280082c3509446ecb5055c82b399e0ccc2cb53e36db2b366727e8802cdf679294e1c608026a009604361a8c7575d40d4285cb74d342d2c7717942222f991adb82272039d21caa06254f7e45bfda5fd1cb3559dc56fb2c5e3d21de04c3012fea73eb4d4a714d159", "0f"],
+  ["spvproof4"],
+  ["0x4e4b9cd37d9b5bb38941983a34d1539e4930572bdaf41d1aa54ddc738630b1bb"],
+  ["a0cbd33f19aa3c22fac0c085ed80c05aa52d1429240c20f2751a23ef8922664177", "f90320f90131a006dcde6bd003558b0e79e45bf5134f15187f6b3c1225e0d966e0f9920bd487aaa06c4b94e98b84dce9c1a74376a1540f37137be8b9a0f726a68a7739714b0a16b7a0a9a02fb73b6800b76df8dbd95eabf00bffaa5089272131c82460793b1a89fa6ca03670af2bce604504a2601c8650407302da388209ac03644f1a67cd05cdf4746ca0b4df7b48c2b5f2a4a7cc739124ced180d14d0115d3ed0ec77354eac3380a9770a0fe97d99da71de75568d97cfd58ad6a1528b8d5a1784e4b540f8ac3be7e86dfe4a07cd7fb78132f9e726e6b1e9c1e44a2ff9e0fb7b492d753a828e17efe2e96957ca02dddb2b58cdfeddad50654cfabad7bd77f638511fd76d73b5f6543a4eeef4531a05649803e27e22c01da15ecc41dd8c9ff30ef387f48f382cc9150471f979a704f8080808080808080f851a06fda95297d17e6cdd616e24a2e3c387f495a23b5d9d6ff82b591d1ddb317b39da0c149adc727f92c51a31d619f7a35d0b914292d68b0b2cbfed0981611d283b181808080808080808080808080808080f8b18080808080808080a0344cf71fcc29811b49f50c5b8191923a2b042660643034f390c7c07c2cd76990a0ffb7183f617efca44feb00284c1bf6daba433baefb8e16c8966cd24443b60917a016025224d2f782da624208506470f2688452c1c8cd510b7d95fddae8b2ebf573a0bd62e4f86cb17e4091d4dc78bc9c03a1c93ef17d1583ae15677681aeac15188da09d07f4272f5c963c5a4d97053a6fb3acbf542a44ee2b4360fdf11e58d9ca696580808080f871a08e4a3f2c87a9872867e8dd69b14d7f841e6a149d155bb78d2e4f8fd54e1c0179a0974ecca960d0b0d510b8b0873cff17190d2d7a38d2dd85968f3d147b4041d775a030f32691431fd4c8d98445627926e4bd09a90c5b83ba946e465106c9303c93e98080808080808080808080808080f87120b86ef86c0a8504a817c8008262709431e59a754f29fd9af7c44d63cda72fe0b849e4398806fb03d5c20580008025a039ceb86758daa5162c6cdd932b498e4605c960db71e66fa29631216f3aec605ea0124cc41f49c53b3dee0534cc322acfc51ba5a83bf1e86ac567c9b500df9dcb6f", "f86c0a8504a817c8008262709431e59a754f29fd9af7c44d63cda72fe0b849e4398806fb03d5c20580008025a039ceb86758daa5162c6cdd932b498e4605c960db71e66fa29631216f3aec605ea0124cc41f49c53b3dee0534cc322acfc51ba5a83bf1e86ac567c9b500df9dcb6f", "81c0"],
+  ["spvproof5"],
+  ["0x74bdf5450025b8806d55cfbb9b393dce630232f5bf87832ae6b675db9d286ac3"],
+  ["a0a4e60606f59a911abb9dfd8817e4269d8b7fdef3e729f3645b1f468c280ac68f", "f90603f90131a0f191d8985c7b637b955de4c8b81d7f7f15c97a92443c65966b2223bb239c6235a080687c8d07cf5b24b6810eb267b9d1c1aaeb4d66877437fbb5f9be3c92428140a060f73715291af5c3f9efa4bc35299e6b8fa0fda68278541ceda18c5566323091a0ddc7fb1c94ac13e70c64c814dcc11be5fc98658fc46c4d7dbe882f6f2ff87a86a0ccb3338686725f9ddb37c02071d5b4567766cc96df50708131f004b92bf54596a0b856c07461ce990380e4984f7a73e53be2470b8398c29d00516440d8114b90bfa097830f293f305c5eff72912d49f22f51962ea1d1b32d2252d0375e687961c912a07bd1976fe5d0211f0aebc3327f83c98a32f48010ab2707b8014c11723cc97469a03d0fd629cafad74c14c2c4772765b8d971e3392042d6d53998b7ea055e11f5958080808080808080f851a07024b4ed71cba8f63364888aa55d71e80a2d8500163275bc837cd7aa106e3930a05b4f5582651be3650721a438db5e53edd312c03dc8235186826367693994da85808080808080808080808080808080f8918080808080808080a0429483cf58e656f0911db74e7ce4858e46ebcdc847b0a4efa828611fc7ba198fa0cfa5e3201c1285d9dab793b2ad32c055c2ef8c396268eca6e3b237fa6a5c2541a07811542c83094051270c11846561b4da125badf0566c1cf62abbb52ee555bd7aa0802be6b46847237e2744333e1eede13b233f9805d1b168c875ef50b7c3ac95158080808080f90211a04ebc620f54969dd31bd30dbfdf6d8c85092135e91c86f82a9fe61bfa0a2e5650a0242566ef36639704fb47dcb44421bebefa5d1502f1dbd2c2086d4b6fe37fad65a044c56b84849a54fd27435e8bdeb672b020edbe5185ab6bce8fafcb26fd3031c3a0501ac7ad5872f36318a2d6fbbd17a5d332e065046b4296e452b195affd8e7012a0ef31b75830d830a43e16f87b7f15a8253ddc7410f1a6440c924417c557b8651ea0213edf40e16248dccbb90f6dfa5396bc5e4b44422ead0051f2277df4e8173808a0e2987df734c342104346d069713bc64fe33cdb2d586e3e6618a0aee982bcb87fa0e0fc5f0dc97913343db6f5e5c444e9008c61bb7030fef3379bdf7f3b23c7daf7a027e033df2dcd45a952722f71fa7173acd52e00212ef3f0bb42d79067e773a72fa03c2e9183bb2f2d14d72be18d916eb0955c7bb9f43d97e0e0a1205ab05e3b3a70a0ecb55922479d600a50cf027da649ba354f4e30a6ef8664705373ffb33b434b77a029ef54c181f550841aaab25968a12a5fa0a875dc7e2028c495e9ee7505a52c78a0e6379784c567240110a21acc2140a0cc616e6ae2cf79f9e3b65deda7a848cf2fa0c24c9a30896d5ac62c50cb1598013c8c11b1b0525f762349030e5962b70dfb8aa0b7bb6417b156ac0daf8b56176c28b30dd0c5e5cb90cece6ae61be2403c857602a0e437523c5f5e8a0fcc1454872da8ccfced0948a1195cc3c897f80d493f4d145280f901d220b901cef901cb818984ee6b28008303d090948d12a197cb00d4747a1fe03395095ce2a5cc681980b901640a19b14a0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000053eecff4d190000000000000000000000000000d4fa1460f537bb9085d22c7bccb5dd450ef28e3a000000000000000000000000000000000000000000000000000000006b49d20000000000000000000000000000000000000000000000000000000000003d60600000000000000000000000000000000000000000000000000000000054829e730000000000000000000000005403921d72cbcda017a915863a57189d65ad52d1000000000000000000000000000000000000000000000000000000000000001b92d46219a426a277ed6c1abc01f49fe80d4460fe9473f058d821d207a3133b8753887e0d6897fd91448090f363a57f42ce2b3ac4bcb23f4f233c2733453144eb000000000000000000000000000000000000000000000000053eecff4d19000026a051f70c90daf5c7224cd777762274b1703778e02bdfb15a353b85f91de35c2652a01881ee92b94851db15dc374880f5155daa6889f6f9589f3319b8954bed33be83", "f901cb818984ee6b28008303d090948d12a197cb00d4747a1fe03395095ce2a5cc681980b901640a19b14a0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000053eecff4d190000000000000000000000000000d4fa1460f537bb9085d22c7bccb5dd450ef28e3a000000000000000000000000000000000000000000000000000000006b49d20000000000000000000000000000000000000000000000000000000000003d60600000000000000000000000000000000000000000000000000000000054829e730000000000000000000000005403921d72cbcda017a915863a57189d65ad52d1000000000000000000000000000000000000000000000000000000000000001b92d46219a426a277ed6c1abc01f49fe80d4460fe9473f058d821d207a3133b8753887e0d6897fd91448090f363a57f42ce2b3ac4bcb23f4f233c2733453144eb000000000000000000000000000000000000000000000000053eecff4d19000026a051f70c90daf5c7224cd777762274b1703778e02bdfb15a353b85f91de35c2652a01881ee92b94851db15dc374880f5155daa6889f6f9589f3319b8954bed33be83", "81aa"],
+  ["spvproof7"],
+  ["a0f098b19e48f22f7c09c78050f950a88b59487e1547d0a85c3aa82ba2338e37e9", "f9010cf851a074f3872fcd15d81d0f96548ef05391bbbc320d5279ac30c054e356b33af3a27580808080808080a06491e283ba7141af8f8e8bb08d1ee2117b2406d69cd3450ef52e750199d82dca8080808080808080f8b731b8b4f8b202850bdfd63e008302117a94e94b04a0fed112f3664e45adb2b8915693dd5ff388349dd1485a614400b8440f2c9329000000000000000000000000fbb1b73c4f0bda4f67dca266ce6ef42f520fbb98000000000000000000000000e592b0d8baa2cb677034389b76a71b0d1823e0d126a06d55d4700646df79130d28bca427fba88eff853e47c2b863c38bec29ed264c0fa0206b74dd4aa09a05c9beed73c4009d37ba9fdaa8e57f9fe93123893f3f07c5c2", "f8b202850bdfd63e008302117a94e94b04a0fed112f3664e45adb2b8915693dd5ff388349dd1485a614400b8440f2c9329000000000000000000000000fbb1b73c4f0bda4f67dca266ce6ef42f520fbb98000000000000000000000000e592b0d8baa2cb677034389b76a71b0d1823e0d126a06d55d4700646df79130d28bca427fba88eff853e47c2b863c38bec29ed264c0fa0206b74dd4aa09a05c9beed73c4009d37ba9fdaa8e57f9fe93123893f3f07c5c2", "01"],
+  ["spvproof8"],
+  ["a018197cbce03e417d2901174b2ff6f6471b8c9be986d898cc77ee5a0dc511ad5c", "f90179f851a0b970cee2182776fcdd401e8c76bb5bf769e0149b7e73923ddae0934f1b95719780808080808080a0bf3621b22fb9cca2ac133021b21b2935731a302852302ca05b9263d55328a5db8080808080808080f87180a0247e69b6740edbfc99a7ec1a6b162224d5d3fcf864713891dc6b982de4262562a02747cdb5489d527767cdd229292135cd92375c204dde61d85c87da779899a64aa0df0aefb5ba109a065811a02e3bd3f198035b53ca72d770ce785fde443be4e9ee80808080808080808080808080f8b120b8aef8ac821ebc8504a817c80083015f9094f0f8b0b8dbb1124261fc8d778e2287e3fd2cf4f580b844a9059cbb000000000000000000000000211bef7d55522b2a0d67328aaa05094bdee87df10000000000000000000000000000000000000000000000000000000003f940ae26a0ea02262d9c8bc401f3a367c887a3f6660d7ee42f9a78c713564fe92a0d9b6798a05e319a1a836133eb90099c6f063fb107f1bc581e014d1c4cd117e540f6058aed", "f8ac821ebc8504a817c80083015f9094f0f8b0b8dbb1124261fc8d778e2287e3fd2cf4f580b844a9059cbb000000000000000000000000211bef7d55522b2a0d67328aaa05094bdee87df10000000000000000000000000000000000000000000000000000000003f940ae26a0ea02262d9c8bc401f3a367c887a3f6660d7ee42f9a78c713564fe92a0d9b6798a05e319a1a836133eb90099c6f063fb107f1bc581e014d1c4cd117e540f6058aed", "03"],
+  ["spvproof9"],
+  ["a031de9f64927bc2353ccceabdedaf5d221f744849b68fa066bdddc5ed6fc7e7f9", "f90121f851a0f41db956068586e3504b40c965f4e69c7e553ed10cec9c2cf5fe73d6df051cda80808080808080a0758e92d88925e020e62c15c8b30ffadf7326355cd9bc75f14e1929f912fda0088080808080808080f85180a07875d7b19ed6c284f80fe14d326694d07bcfc3338f945e28cd1a515088c789c6a0fe2da59317fcde4955e091122c2baee3b2b0463a6a7cb73a7db1434e402cf4218080808080808080808080808080f87920b876f87402850a7a3582008255f09426d5e3390d6f309e63af1caef0a2d9d7507c3dba8846c6d6faa27e0000885a65726f436f6f6c1ba0a6163b20f15b7127b1b2f37079256f9f9a458da1e1c04cb59122d9803fb42ef0a0536ab84d25af805ae1495f023f43851942dd40db263542f1523202c29bbca445", "f87402850a7a3582008255f09426d5e3390d6f309e63af1caef0a2d9d7507c3dba8846c6d6faa27e0000885a65726f436f6f6c1ba0a6163b20f15b7127b1b2f37079256f9f9a458da1e1c04cb59122d9803fb42ef0a0536ab84d25af805ae1495f023f43851942dd40db263542f1523202c29bbca445", "02"],
+  ["spvproof10"],
+  ["a03a9ff72c3cd0f13edcfae1247baa9a6ae916ac3304943c973c6520544e9e5ea6", "f9013af851a0251094a66215be0dc7cb8d2549f73a723822f429e5ad6ca1bbf3011dd3de65d080808080808080a006f783663331afcae7b64e6072b4912587157eded1c68cd7b9b5dd3839e073bf8080808080808080f87180a09f9ba82c04e79e49e64e80fd70c6a84336fb01e85d06861b1c79db25528aa20ba0f49cd01bffb84f9c402bb8288d31b9152ba83befcf6427432e7d32933f262149a069eb752e2ded445c5fe7ae8e305ba8a13a96bdb96b1e8caeaeff7ae628d7ac5f80808080808080808080808080f87220b86ff86d01850ba43b740083028b0a9424f21c22f0e641e2371f04a7bb8d713f89f5355088029f49061e4f60008025a0f2b98f118ff263c32e506b27c6da31f96f6ae2e018b69425e97d60cedf4382d3a037ad19177e318ed9b972f7b54c55a1d8030efbcf768952ebe6c8976889277a11", "f86d01850ba43b740083028b0a9424f21c22f0e641e2371f04a7bb8d713f89f5355088029f49061e4f60008025a0f2b98f118ff263c32e506b27c6da31f96f6ae2e018b69425e97d60cedf4382d3a037ad19177e318ed9b972f7b54c55a1d8030efbcf768952ebe6c8976889277a11", "01"],
+  ["spvproof11"],
+  ["a0ad6572af16ccec83dae3476a605b9a7190d0dc574cc6d00a16b2e2556f0087ee", "f9013df851a0e717ac9a129091ec57ea9593e5533286711d594ea52646593f7ca19507093a5680808080808080a0e2b6bfc9e4c18477cf85aeec954914bf340372431ce8db28b49dbf49716063088080808080808080f87180a06014bcf39ae46a84e9128209e4ff02535e7d1d1efa543d870dd10ae4bba1f125a04c7db7951f8e2061bb314613f270f87259999694c21cd8699c6133d1c6aa5130a0fd225efd745d050077b2b27030e92629345f9f025017deead105895a63c37d9880808080808080808080808080f87520b872f8708302b740850ba43b740083015f90947af87a6d25246b24301347cf0662926760c0b013880f6ba2d548331400801ba0ba2d6e6f37342fe31d1e7776046aab67db62f0c77505ab98ad15e5318c87558aa03c62f76fb357591f1a1105184fc42d55a27657182709be031ae0c5c4fe46f9d9", "f8708302b740850ba43b740083015f90947af87a6d25246b24301347cf0662926760c0b013880f6ba2d548331400801ba0ba2d6e6f37342fe31d1e7776046aab67db62f0c77505ab98ad15e5318c87558aa03c62f76fb357591f1a1105184fc42d55a27657182709be031ae0c5c4fe46f9d9", "03"],
+  ["spvproof12"],
+  ["a0f7e9dfc1ab46f0b4580c37044f56e7f1c32f42280125b5fb051fc32163af6d33", "f9015bf851a07f78c3105f24a05f2e28e63e0f3f39f7eb3e3bbb33602575c9e70343f772dff980808080808080a0d4d37b63bf6917096ad11a2db6c7e43064ead27108692bed27b5e4119c03b9b98080808080808080f89180a0652d2d590773ce9b36b4fb1e50382a2cccd5acd5b3498ab6cbefbf841f6d5d87a0f0c87d70a8ba6ae9ea70818d9d604d04637fe4b8330655b34157f54976ba1b45a0da4c7d05857015fdead951e27dcc8bc70a3b9124c7e47f2d0cab0ff3e6b82701a0ac15d013c765dc0b9080273272e1acc05356d10697974995f14f4ea3dd7f4f63808080808080808080808080f87320b870f86e8202ad850df84758008252089432be343b94f860124dc4fee278fdcbd38c102d88880ff472f6fbe61400801ba0ee2934258c256dfaf50c998a2f6d22144277d56b92880457b2ab135ed7f6db07a06295b1f7cbf469ce0b7d5f522eac628bc14a297eac9db657912a01b69d25a297", "f86e8202ad850df84758008252089432be343b94f860124dc4fee278fdcbd38c102d88880ff472f6fbe61400801ba0ee2934258c256dfaf50c998a2f6d22144277d56b92880457b2ab135ed7f6db07a06295b1f7cbf469ce0b7d5f522eac628bc14a297eac9db657912a01b69d25a297", "02"],
+  ["spvproof13"],
+  ["a018f2a30bb2c4d0818a253d287ed8c1defd65d6d3bcf47cc355b4fcf6b17ecf46","f902bcf851a03b336aa1f6c6cd88d2e78561a6e35b062f0d4faa8295b3dd4fd4082aae9be2de80808080808080a0d80e62fbbacd9b1a058d7262f1c5aac18694f4fb5fa3e79ee94305a166872af28080808080808080f901f180a091e4ed9ce5f63c94b54394f2e8fece56fb5440c21da2a799903b51ec04c120e1a010d1557be630665cf06036f489691157d8813cef4977e0939db3b961a942bc26a0680b47dfd75a4578d48cc3d4f1b7765963f41bafb80df5556d3c4d76798515b9a0867e5b6a34a7351d91dc0d197bc8737251b390b332baf52b99d3786c97c5a960a001e54bccc835f610cc38142020aab5a0dfc9022ccb740f19d3b5a24cfcb75ec0a01e6b5a6184e5b86ee2805a426794ec39785ee432f9b4b930e97979d67634e2cca06dcf843b88a8d3d7bf3589b53ff0f5d06151fac071dc8ecf8acb7f3be76ad0e6a0c8fa4fda40dff8a1e835a2a546ce4c3fedc0818f67715b73e9f7e20233d6cddca0a07e2d25e54d11c83efd869d20c090887f5257b57005d03a8ea005443d136dd6a0be3c61e0830713f157a019b126053c57224eb4328255a078306ead2c702efeefa0bae76624a2b82df6febd4e8b8d77f0b5ed56cb150abe7e2a9a62a9af77e4ef79a0d39cf188518803816c447fd4e30359d2cce588a28f7c8f5954f09c1e6cbff6eba06e94fc7fca3bff828b7084113ab468c9c232e5301dd20910efdb4e799786bc74a0001fefa4fdaa1cbaf4ebf977142c4135d75bc351593977fe65461e1a3f49d6b6a0e015753585040da47bc60e995a240f1ba05c4f800f847d0e4cb65ab9f87fe30f80f87320b870f86e8324102184ee6b280082c3509446ecb5055c82b399e0ccc2cb53e36db2b366727e8802cdf679294e1c608026a009604361a8c7575d40d4285cb74d342d2c7717942222f991adb82272039d21caa06254f7e45bfda5fd1cb3559dc56fb2c5e3d21de04c3012fea73eb4d4a714d159","f86e8324102184ee6b280082c3509446ecb5055c82b399e0ccc2cb53e36db2b366727e8802cdf679294e1c608026a009604361a8c7575d40d4285cb74d342d2c7717942222f991adb82272039d21caa06254f7e45bfda5fd1cb3559dc56fb2c5e3d21de04c3012fea73eb4d4a714d159", "0f"],
+  ["spvproof14"],
+  ["a0ea589e0a2602c8d8cae2259d57ad3a8f98c993b92371cf03963e06ecf3949862","f90196f851a01310be11833cde06b8f64d272707e8d9712abe2e993a4c2a070b9aad8ad3335880808080808080a0c968bc4ae59ced430366d0989313f150690ad8321409b20511fd98c0b1d960048080808080808080f89180a0517fc0abc0fcba059cb0675cf6b76baac7e5868f390435322145a76c5bfc70baa02c1761112abe243441f7ac71d28e315137f22ee09f5ea76ab8d6f4743bf79567a07ea2c30e6a731fd471314d024945542cda74174c44fd19a1607047ebd46486cda0335a484c9c2b996c793d667f9fc7efa2336fb2a3b1d027435961f7751ee07367808080808080808080808080f8ae20b8abf8a9358504e3b2920082d38e944470bb87d77b963a013db939be332f927f2b992e80b844a9059cbb000000000000000000000000ba26ce21f2f0e3f2f75996994e7a51b63b58ccc600000000000000000000000000000000000000000000000000000000004dd1e025a0f84d39f7d2a82cea5e54546a53e3e989836761e231813781af3bad3ac63df970a046b71c861c4b1ea29bb259f4ee7cb814d97cfbb9f8174c15ef074cde26b1167d", "f8a9358504e3b2920082d38e944470bb87d77b963a013db939be332f927f2b992e80b844a9059cbb000000000000000000000000ba26ce21f2f0e3f2f75996994e7a51b63b58ccc600000000000000000000000000000000000000000000000000000000004dd1e025a0f84d39f7d2a82cea5e54546a53e3e989836761e231813781af3bad3ac63df970a046b71c861c4b1ea29bb259f4ee7cb814d97cfbb9f8174c15ef074cde26b1167d", "03"],
+  ["spvproof15"],
+  ["a0fae44bf08293cad7ec9f1e1d42cfb8398cde79c6b4db2c663c0f9b519f019299", "f9013ef851a08c90646abfb0200b8a136863de91b428ae79d91b83e41ef0eb4d204e55f0194680808080808080a0c202014a45da4962502ba3f972139851edd54c1225c359f806c505abca11fb078080808080808080f87180a05c7566f0c0d2f6aa56e18893c1d1f2d7b80a17b6fd88aa71ceea16cda5872035a068afa1431705d40839f2782cb32cfa86e64ca28784e77316c18718f2e457114ca0ff6fea5f21defab24240ccf4d38625c36e1b7dd1d20d4d790220160286156d0780808080808080808080808080f87620b873f871018504a817c8008288b894fa52274dd61e1643d2205169732f29114bc240b38902b5381f1d46e700b284f76541761ba06a31621e3166efed2949577acdc9e6914b2cf90869ac0d1395243216d6fb6a93a06c5a41909ed3fd7a028b43f05fee5398788e59d78c2af77b2e2c3734e1c42780", "f871018504a817c8008288b894fa52274dd61e1643d2205169732f29114bc240b38902b5381f1d46e700b284f76541761ba06a31621e3166efed2949577acdc9e6914b2cf90869ac0d1395243216d6fb6a93a06c5a41909ed3fd7a028b43f05fee5398788e59d78c2af77b2e2c3734e1c42780", "03"],
+  ["spvproof16"],
+  ["0xb9879c848cab750742962c4b900c68b3be855a7ef5667cdcc21557765c55a1d1"],
+  ["a035b3f3fc04cf2b9f174800736e6b26e12f639483bc3309a56d3c1601861b18f9","f90685f90131a053da9acfe2e06dc7f04ccbf8beab0413916ebd03ab930f5853ec0f70d2784d52a06a57220d3807f6f06628f245094ec54c2fad458cef3721a12c2763ce1775cf9ea0b078eef2f5b7464b3d8369d0d991f14798cf7d50352cd76351e69a89a6ed0b9aa070d91b8980bfcc5a82ab3c1e617d60bed2d09d2218080f946ff9c365edeec89da09b4e501c1d4c7e0e279a6822257e931c605de663026255220574082913413bbda076680dd1930586a8f0b022a140978cbda42dcbff4875aac67cdf312088fd8905a0f3d9cde79be81863469b08f571e6804bf3449ec4177eb85db4f17d7219f8b7d3a09dd568a81dbb9f09346556fd5b406340b1966b1476d0a98b7a22b8812549eec9a0ef2774dd310ee9c9c19302fb1b22661dd56c899f27b7fef6e0817e1e7b52ccbe8080808080808080f871a0852be02f7cc9952bfc405dab523dd0742fd9f27ed52719c4ea5cb31c8492f17ba034cf98d1e22413868e9ef64adbb676748d404aa7986ecf88f86294ba3c49bbc3a077b9fe32a171d929ee50a8adaee447351ca014f0091d64450cb90a346b2339cb8080808080808080808080808080e4820001a0781517f2fc80018ab1d53254cb8a2c92896b75cbe8675ccfc6e8c27904a1eed5f851a0ac5e057e83640dc69b28f15749f5553d9fc9bb0fe33d3d4433b82f389871ba57a0d23e202badc0bd8eb182485d80b2c2963ed057c87dd5c60f034c8f9f6223a158808080808080808080808080808080f90211a05063444e0892877cf203e289792a174bc23cfe94adc11a3b3cd2586655fa4d82a00faf3ce245eb01a532cccd06fd831fa86dc95110156bbc7e8b8a70b73348ab7ba02ccdb134175fc7d70899fc6ff6f5f397403f3cd559146ee66e18b1af284cb4f8a04b63d3f634f4ecbac6c9e6e6f0e2b3bc95bad2893156522833d86ceb7b50cfe8a06c8796c5be4e79afed8ed127a3bf8f6c6caf6c212dc07f0980fa4cc274c61c97a089097b0f6083437c2e82d6ef0e491a12a4e8edfdf361ca8dbf72377085a1cad5a021f6a41413f17939ea60017321212316b59d8f9692e282bf9fb3374e63ad58bda0c1b7f99db10f3fa341a802f32898b23f8eb38b10d5014b74b9e1f2c668a7062fa07391277a5ebeb17828fe72c559194e6e662deabc1ca9e51c451ab280e2354d3ea01aa57b364f210122efe5f42fd6abe03f4e5ff676700f2162f152b16eb4fa535fa04521a62ee3201572f3fbf9f21a04f0824725abcbecefab959038cdc67539669da0656bedc18adfa250df4c35f394075af6d2aa99382a312baf035782a78397aceba0c2cbff6371719f70e0fdfeafa3a788f0d3de7a74eb3903cb27aea8258cff7d5aa0fa76663d79428e4ac454ecc82be91847b4fa027937f6f9d6e1381241e75f44efa05e8a32bf0338915fe83e8aec041413b827c4c9ce78c39417862e5b9cce399771a0a30d1fbc7e5c7cd5567991c12846e0d527da0932dc37b992673b5f88a37e66b780f9024f20b9024bf90248018401c3889cb9010000000000000000000000000000002000000000000000000000000004000100000000000000000000000000000000000000000000000200000000008000200000000000000000000000000009004000000000000000000000000000000000000000000000020000000000000000000800400000000000000000080018000000000000000000000000000002000000000000000000000000000000000000000000020000000000000000000000000000000000000000000000000000000000000000000042000000000000000000000000000000000000000000000000000020000010000000000000000000000000000000000000000000000000000000000000f9013cf89c94f3c9b7a97eba579f5c234f79108331f5513c9741f884a08c5be1e5ebec7d5bd14f71427d1e84f3dd0314c0f7b2291e5b200ac8c7c3b925a0000000000000000000000000ff190a4cc92b154635140335791d3779f60dc311a00000000000000000000000000000000000000000000000000000000000000000a0000000000000000000000000000000000000000000000000000000000000205c80f89c94f3c9b7a97eba579f5c234f79108331f5513c9741f884a0ddf252ad1be2c89b69c2b068fc378daa952ba7f163c4a11628f55a4df523b3efa0000000000000000000000000ff190a4cc92b154635140335791d3779f60dc311a0000000000000000000000000e8bcdac193f0003143434767e0bb1bb1757efa12a0000000000000000000000000000000000000000000000000000000000000205c80", "f90248018401c3889cb9010000000000000000000000000000002000000000000000000000000004000100000000000000000000000000000000000000000000000200000000008000200000000000000000000000000009004000000000000000000000000000000000000000000000020000000000000000000800400000000000000000080018000000000000000000000000000002000000000000000000000000000000000000000000020000000000000000000000000000000000000000000000000000000000000000000042000000000000000000000000000000000000000000000000000020000010000000000000000000000000000000000000000000000000000000000000f9013cf89c94f3c9b7a97eba579f5c234f79108331f5513c9741f884a08c5be1e5ebec7d5bd14f71427d1e84f3dd0314c0f7b2291e5b200ac8c7c3b925a0000000000000000000000000ff190a4cc92b154635140335791d3779f60dc311a00000000000000000000000000000000000000000000000000000000000000000a0000000000000000000000000000000000000000000000000000000000000205c80f89c94f3c9b7a97eba579f5c234f79108331f5513c9741f884a0ddf252ad1be2c89b69c2b068fc378daa952ba7f163c4a11628f55a4df523b3efa0000000000000000000000000ff190a4cc92b154635140335791d3779f60dc311a0000000000000000000000000e8bcdac193f0003143434767e0bb1bb1757efa12a0000000000000000000000000000000000000000000000000000000000000205c80", "82010e"],
+  ["a08c94c9981e69cc50806830e150eb78470f52266cea5be5564d75a7eab1d43a7b","f90504f90131a018a4c7230874cd62ae76207cb82cdccf1055d4c5d35ab785ff0b1b8982b9a8a7a04a72b9394f187e8fb0bfdf39a1caa596ffa7efb5c5e0172917c00dceab492113a04ad27b42faa7395850bea5be161599c557d4c3dc3fd6e215601671e9ed049b57a0e784c078467b7c82c0594f71d40d1448685b464ebcc60dca0f93d8d702c60542a0f997560d1cf27aaa1c91bbe5ee5ce66a84346e981a5943cc47ffe68f8b213647a0d55d49d02feb13a70a923e3d9da49d546e3159295279266c9d6a5add2d697829a0ab306db52f6ad78532e9ecde215ea9ffd555dea08d55d8708648b154c3a2570fa0140671416f040fe105a924bdcc73f5628ff02bb7fe0313cabe3ef98a4220a319a0bc5ea631d17e77982ebcddcacb93717e11d4fff9bf028b82b64963ba781bc79e8080808080808080f871a0c19a9464db861095f1bb33b8ced113b5ed86ea543ec98729fe321cb42cac8b91a0451eda3432ab55bdee5b89c50441819b41e9bf6ab9304f92490fac91a189c5b7a0753a4cf12cafaabecc323a8d76f81918e3e20334373a4c308dbf949bc88510208080808080808080808080808080e4820001a097262144577b9d30cb302491de89c6b611e96afc0dd47181d0c2741ca6eed5cef851a0ce4ea4d30a179f68aa06bb0a3a64ef252bb2d3ffa477ddb851fc473607e8deaba07cbc5dd7892f3425f7c77463b487cdd9b0e90c372cc6de91a11e7f7e67013fe8808080808080808080808080808080f90211a026b7dce8cbf8252c5f1942d2f3e1f7c463e8a402674555f400a5ab4618081e16a0e294136a916714cd9e7b0e5f77a9c9ed9c81957d4499d5e30b89a0ef08714521a09161d85fdc36c4eedec40daf637fa1e987dfb98887ad25f5590501ecf6aa2614a0f65c3f4518772cae1c66d65a436a7240e075a1e6b4ce0cc0b36507774ed1fa3ca0b1d0595dcd2eeca53800a245af48240d9925d3d322cbab5181ba5d4b218e3cc6a03a6686d2ecce7fbbfd5bf1b6e93eda89805904202afe9c00387582ed9422fbe0a0c01e8491b30e02624bd5da5f5a53cc50ea6de826bec69ec287634226298429b1a06e19ec312dceac027306576483315215e446a060a3a4bfe592893df02d022d65a0b5cc4009c433367f5c318945c9f04b62dfbe5cdc474f42eb4a45671e6782c76da023cb00d6d1e7c3351710058b08983a277e8ce07164c0e9f9f3288995f7b79476a01ce2e0798bada98b6ae1e02fd28bf407c5eeb526e9f0331710851a141e5c5a33a0eb3ab45a89b1b832f44a874af0a0cf56abe0708717909be07bf29c2b0b8832c8a0d95ebb6ee11c73dd5aeabcb16d42bcd81adb3b0d7a3b53a31f9812ed5529013aa0a71b1620d1d9e236cc88aa3d1ed6c041dea2d7e185ddbe29f2eb86d4c6e20aada027a665a6be0373369db5e286bf1333e1c71a54083488b4c01ed0fc2792867042a0680f03114a731e46b333f0d18f2230bf66aa548f4aad169b496fe1d231320ddc80f8cf20b8ccf8ca3e8516b6d947ce8301a52294f3c9b7a97eba579f5c234f79108331f5513c974180b86423b872dd000000000000000000000000ff190a4cc92b154635140335791d3779f60dc311000000000000000000000000e8bcdac193f0003143434767e0bb1bb1757efa12000000000000000000000000000000000000000000000000000000000000205c26a05d1a536243b4d4d87fbd4131bb48fbe65b999b1b6635f31e8f7100e547a93673a0618619617800a5b1bc6862e4d7f39d3a1121010c84dab8fa2dd825f4c5f2f287", "f8ca3e8516b6d947ce8301a52294f3c9b7a97eba579f5c234f79108331f5513c974180b86423b872dd000000000000000000000000ff190a4cc92b154635140335791d3779f60dc311000000000000000000000000e8bcdac193f0003143434767e0bb1bb1757efa12000000000000000000000000000000000000000000000000000000000000205c26a05d1a536243b4d4d87fbd4131bb48fbe65b999b1b6635f31e8f7100e547a93673a0618619617800a5b1bc6862e4d7f39d3a1121010c84dab8fa2dd825f4c5f2f287", "82010e"],
+  ["spvproof17"],
+  ["0x46b7421e52b61dde0515d0c0eaabe0de9513e763ddfb8eb5014e780f5a09199d"],
+  ["a075c0b0870c8017ddd67d0ae4fa1ac1ea74ea36d0d6bbbfe777295dd046011c37","f904b3f90131a0327f84fcd358ee2aeda7fbf0e6908789942ff05aae12c594e5ac2cdc357e708aa04265515199acbb3bd50b8f0c510f5b61badb917198063ce6b4fb4781fd6d38eca022b25a3bcb4124633f5a2531a82c5cf5cd344637c4458e95973a83ece8368b7ca0ed39626817927117baf09881ad4e2795aae1b0b306b3a5cd2f5a76412dfbe43ea0af7ab8f1a613411f443ec4bb5aa6b7db8e0b890a7f46fe3d0c31dad89fa4e78ba06b20a6fee0621de0a659b94b4c958dd93856d7ed0b38e4e969da6a91b94cdf2aa050730b56342cb4497a98de0439b1e14fb481be375f380ac032f9813caa1d7c5ba016cfadf82671b4b1c7ce6e372e7ca5e6d51f08c1a24c67b721cc413dbc214e77a0cbdd0f5d4d60cae16f62f5c8353c21d47fe4e06b3d6340fa7fd24010704ca5268080808080808080f871a03bb912febb652feb2a57eaf73224e4805327b6d8ac1c0a71e0b5616a7fb30944a0bd1994da90e44abd68e5d02057ec43014942346cc7a1f9d926c1fcde3c1d48dda036b517af861c6ea84233576b639bcf39ae3dee66c5510f3b82ded29b1df1af848080808080808080808080808080e4821010a0473be7ae92ef7a9e1190d2e5e5911f34dc7fdeda3789367c62b4aa8beb1bc8f6f901d1a036677d3845ce452fb05f3becdf710e27f1a1b1d3c7a92f00b04b97cd67a85b76a03f869e64aec1935fd03ad958fbb7c32ec33e382d8ca1cb3ab53e35dc8edd6298a0cd6abbc4229bb3980872b5cf5523535cf1f23f7ca0adb172d1dba9a787da977da0405f3db426655a703325f5e7602d94c8fcf203599f56c80d582c1580334e73e1a063d621ecadf059ac2a66b29cfc98065b6f9d2c0c91a57de116a4adebc6d70bb6a0489b126f4dd0b4f5fee83a388870c34eacaa19b901f8bf7e3e88c6f8f01bddc5a07825830bb1d1be9ed9678d91f75c1cf3b4e27484475102eb8aa5af87375dfeeba09fe59dd942ef7716ecfd87bea738807c9ab59a71b92771fcfea259819e412e6fa02ac4f50fedfe8bd3d9be4512d8ecbfdd1e88637a977476d60209b149f59df972a045e65c95e40d3e6bdd5aa307bb0f34e7c34f7c1487a2921e1ea2b40967c8dfdaa0e5db693d27888c6063fdd1a77fda01e4bab6bef25c01c856e16ac363a2a0a789a02d97b0515b00ff34015c49179c52bba077720a2d3668fa1b1756da1e001ab41ba0f234eb44563801832cd7ab37c730d9069246837f12afd23a0deeaddd75406d2aa07592293e55a2265fdbf7ae4d5d3ffeb6dec8253fa9e6eb381544c4208ae9a925808080f9011020b9010cf901098083ccb472b9010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000c0", "f901098083ccb472b9010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000c0", "820100"],
+  ["a0e50bf9999b3628a2db0eed1fb571c0467fee693723a2ce7478a83a391f225872","f90493f90131a0eac7a7055f932b34243d136e9af69230360bf6497ef7ee11031e43f2d76ad461a0ec912e8a430eefc152df85da208d76842fb83778043cd63f12c73406048bd661a07493d592674cd9b2060a66df8d8975f0995031381b0153a6f21bfd1e52fd7f88a0ae3668c7dab50a9b8afb02a96169c5f2f4094e5bc723cb010b1dd40d8739a758a0a8cbdc2c20ae87637d13546f671e696f9a4a5e59bbbab83618a1c4c74d354ff6a0d8ca2f282dbdd7ac58f4cba6c2e25ae03aaf30c7ddcc309ecbb3b5a60069abd4a0c19b4b02e5abcf1a68000c8cc6f71d63a9cc40f2b0b3bb62b2ce7ce168f754a7a03d32f43ecbb9e6ad321f22311899b701a2b86985e1cb6683f2e922e732c18bc5a05a1e76c93f2bcac94a355313dbdee47118186e3e8fbed49a9b6efe56838b270c8080808080808080f871a0d2d7fa77dfdf8fb20aa012e8fa4ed7fe43409d110b320d67cfd3239cb7129dbea0303f4bdf8911b025f41c8c9c96a2f95aebcea7a5b27ef65c8a7d675bde130dc9a06355102ee7cf8ec28f9de7053db0e762b6fe6284d5b44633087ad5f3bf9b2b308080808080808080808080808080e4821010a02515d22d5e2e1fa4cb177de01c982883b3bf8c460336f65766c51f355aa8ed21f901d1a0452cd7545dc2f25ed1a4c3d63e09126c5d1f286bd815082d3657cb68d25cf805a0eaea226918fdbbcbc65d17d002ca2bdf6415d2a07e3f76b53acae9df3870846da029df2e0fc4c413d74e447cd2fa0680079a95ebbb728d6536bfd54416067fb284a0d078756788b106c3791276fa389b1d608e12e45d8e8883f9a025d3b0fcaae83ba0295db39b4f774d7acb87b396822f611b8c548693100235f73066570ea9190343a04c9d37836ff42bf324bcc81f3960b03251a4148b4d6513aa3cb1bc5c611b4d10a08f528f811908c11d9273d54ba2de47567010f898ee03bf2bff9269a39eae8630a0acfdc3bb9307655a521deab1e93d39846127224a5f8cb10bed203ea293493bd1a013e12d91f7b0f1b91a7d5c944de252f36615ea19d0d229e6fc80ee75448a5915a02722e208b8da5f7649e2447f4e9c8f69e9a972bd5fd7e3391f7e741fa549e337a0d99f936fa908f2c7be4f34d408950bcce560d9801e26d954043f6560847b6d5da0ba915301933fa2dc9ad126d59e6bb7a61368a8d223478d5f87e0f35a35dbe5f8a04c2999d90b8004c9359850f31cc485e8d621b1331647fd48dc2afa74f4aa0d73a0f415b71beafffe94194c551f62e589650d42f13e7c1a8068a53cdf4f18d6f130808080f8f120b8eef8ec820b1c85164bdc92ba830493e094cd9e13b2f3bfc26cd99989fb849a2751932595c480b88413c9bb8000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000019b50caea5e4e400000000000000000000000000000000000000043cfda3243aedc0000000000000000000000000000000000000000000000000043d48db25885b80000000000000025a0b6441b995f86161eea68d7107099f682e2681980827266e9f1a04b480e81c585a0333b91316093047a91aaa90bb65e88b93cd011cb5c6bf3da9d69138407e8c11b", "f8ec820b1c85164bdc92ba830493e094cd9e13b2f3bfc26cd99989fb849a2751932595c480b88413c9bb8000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000019b50caea5e4e400000000000000000000000000000000000000043cfda3243aedc0000000000000000000000000000000000000000000000000043d48db25885b80000000000000025a0b6441b995f86161eea68d7107099f682e2681980827266e9f1a04b480e81c585a0333b91316093047a91aaa90bb65e88b93cd011cb5c6bf3da9d69138407e8c11b", "820100"],
+  ["spvproof18"],
+  ["0x0075fc181555a6327866b4bc8044b7660d51b47a92b760fbfd70572d0b0d94b3"],
+  ["a075c0b0870c8017ddd67d0ae4fa1ac1ea74ea36d0d6bbbfe777295dd046011c37","f905e2f90131a0327f84fcd358ee2aeda7fbf0e6908789942ff05aae12c594e5ac2cdc357e708aa04265515199acbb3bd50b8f0c510f5b61badb917198063ce6b4fb4781fd6d38eca022b25a3bcb4124633f5a2531a82c5cf5cd344637c4458e95973a83ece8368b7ca0ed39626817927117baf09881ad4e2795aae1b0b306b3a5cd2f5a76412dfbe43ea0af7ab8f1a613411f443ec4bb5aa6b7db8e0b890a7f46fe3d0c31dad89fa4e78ba06b20a6fee0621de0a659b94b4c958dd93856d7ed0b38e4e969da6a91b94cdf2aa050730b56342cb4497a98de0439b1e14fb481be375f380ac032f9813caa1d7c5ba016cfadf82671b4b1c7ce6e372e7ca5e6d51f08c1a24c67b721cc413dbc214e77a0cbdd0f5d4d60cae16f62f5c8353c21d47fe4e06b3d6340fa7fd24010704ca5268080808080808080f871a03bb912febb652feb2a57eaf73224e4805327b6d8ac1c0a71e0b5616a7fb30944a0bd1994da90e44abd68e5d02057ec43014942346cc7a1f9d926c1fcde3c1d48dda036b517af861c6ea84233576b639bcf39ae3dee66c5510f3b82ded29b1df1af848080808080808080808080808080f901118080808080808080a099a37d1ff64b830d80d0bf627e4797d5f99bdd91c31332a99b4c78d1694e80eba0a930c18ac12b9a5783a81678e0db8353e4aac3e8cc8b6269bc507432fd809b62a0a2be16b958211317e2ad19934882a4f446cf5a1d2ea68fc2ad5d2984d1d388afa0e79933a99dba5daac29247e3aac981b7072ca0f9805b42b5304cb318051f7628a0ca67af21ca271f905b89da3d0f8ff8dfb0d7e9b5978f340bbf3d5808dd45135ea0cd33eb9d4d65a6a171a406d7c36f90e54c0004f2c14174633231b1ee917ca60ea0ce043eb393ba4f8dbb7f4e9a22b2ad8220bb06ef972ea55e9408941e8a22677ba053f9c392366e04a21218de5ab6f8e9a5c3ad6a5bb77eef8670c411199da3f45180f90211a08e5bcb55447421ed95ded04a2dab281123c91c87635e998981996ba9ac93dff5a06c5607c4ac21456b744f19767d29060af46dd2a4b1b6411bbd31433d2601a67da0e23a423827b79d1440512bfc39947e7bb4faa6169b75d4472902ae4a6eb4a182a09bef14431f40c8e55cd51fa8961e36e49d7050fe20cec3936265b1c740ce74a4a0a19964bdb8dcc172baac9a18db5f4da0550ff80f6424bd57a298d0a1e29c53b0a028981cca4812301ac706e8baeec13608028091c45f35ce73e73bc98b96e81745a04d0c5730443cc62d2821c97914e654e0957f05be70f22e193743260d1835ab0ca052b32ce03dc80125f3f50ffbc736034aa3c40e4e9341dd9f10593c4f292b2da4a0d8c74f66a0ce8203c40c880abc86592de8cd106933559333b878836f5823057ba0f78bac7e15a1c2f58d3374fc2d7cfecde5153b15452715d60e2725a566106a97a0306ed7ee67fecb267d36bb4a5b57bbc892e56d4896ab7b7efd295764bfb287a7a068d03ffd30a6cdb416d95bdb072b32e02d4a5416d562db37c308157608cbbad9a092b73158572b701e0c937bc03f9ef853a7583d0715de5fb72b9081a1093a9099a09e33ac0cd6ca349847e0fef61a727c15ed09e04719c8f19c5e98d02f6ca78c53a0ed8877542768b814a290bc6749133c55ec6e504a9ee357ce83075ef3811ba95da07ec53d9f2d667546ecd2e5f7d394a70b4a77215609c5c72f36728811f1373ac380f9011020b9010cf901090183cc2e87b9010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000c0", "f901090183cc2e87b9010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000c0", "81ff"],
+  ["a0e50bf9999b3628a2db0eed1fb571c0467fee693723a2ce7478a83a391f225872","f90546f90131a0eac7a7055f932b34243d136e9af69230360bf6497ef7ee11031e43f2d76ad461a0ec912e8a430eefc152df85da208d76842fb83778043cd63f12c73406048bd661a07493d592674cd9b2060a66df8d8975f0995031381b0153a6f21bfd1e52fd7f88a0ae3668c7dab50a9b8afb02a96169c5f2f4094e5bc723cb010b1dd40d8739a758a0a8cbdc2c20ae87637d13546f671e696f9a4a5e59bbbab83618a1c4c74d354ff6a0d8ca2f282dbdd7ac58f4cba6c2e25ae03aaf30c7ddcc309ecbb3b5a60069abd4a0c19b4b02e5abcf1a68000c8cc6f71d63a9cc40f2b0b3bb62b2ce7ce168f754a7a03d32f43ecbb9e6ad321f22311899b701a2b86985e1cb6683f2e922e732c18bc5a05a1e76c93f2bcac94a355313dbdee47118186e3e8fbed49a9b6efe56838b270c8080808080808080f871a0d2d7fa77dfdf8fb20aa012e8fa4ed7fe43409d110b320d67cfd3239cb7129dbea0303f4bdf8911b025f41c8c9c96a2f95aebcea7a5b27ef65c8a7d675bde130dc9a06355102ee7cf8ec28f9de7053db0e762b6fe6284d5b44633087ad5f3bf9b2b308080808080808080808080808080f901118080808080808080a06925e273514f1530f76d4a9ad6d3b9a36d8d66667b1619aab3ee4e860528c0f1a055136ae1bd92ec4864dde08145ea526825020db2c189a87e1fc5d03b1f699fcca0f604e2bd1461a89fcbb76277a7f1da2e7512571c104fbf23da03f321130b7977a0aa932e4ef5d83e8673f10070d80621a5a7587c50fdc688c686cb58a6209103a0a0a3b8defaa17ed9e1c931497a76cd607e6246df5c6b29d90c7ff5faa90ee93022a05f941f09cb26ef4a6ff29dae6db27c33813d830058a2b5e893393cce65f04956a082ad181f2d43f3d05300863fb8345316f38560d7bf2fd3b685ebcd9bfd2bcbeca0687aa29bde7e1d5d05ae28096a9cc636ff6bf554edba3ebdb41eb79766295a0180f90211a0bef2e9c000af2a0629be716d6e154ba86ec630f85d8e385340ef3379010adde1a0bca09e3e79b30b145e65752e5528e0d0bea7d5a760876ba1cb4046e1e435ee19a08014cf7de0fee4817167a3c1eab42e8238c36e53c41c556817d5a2c49aa2aa87a012049bf37434d551400985990e7ecdb258c024bd2d9f28f3684ade1a28ff21f5a08ca72019fd3fa41ad920191d6ace046c3899c08a7929dd1ae545baec7ea1fdb9a065e92b0260011fbc1d89628443ea9e3c62d28aa9080cf6aaf33c05db0152ccf7a051544fa6e2f84a973f3929957cfbc18616476031c8bd1701d954a04330edce82a069d68b92b454c312a055daa899292e204a2fc6119698ae8ed1f2b02215d6e54ea057ca2e9f35e1bb3d89042db735d7251e8011bc4b47291743dc11149a1a3306b6a0317cf544f2e88fb2413c39bfd2922fe818a01a2662fe9fa7286a770c77ef692ea09abff155705bb1d61cc5a4840c83dc08153fa94c9422a2e05a618d2393c86b74a088d271ddc3fa97d82138d8f8f80df9052fa8dc50a27b5bc0e637ca6f346d0d2da094799180a1334c5c26c9360f3642f86831d5d9c44e742596679e9f2fbb30d80ca09dacc30b5587e790646f610e1aaac771e9e8ce755c6214c7eefe9434afb8129aa0f61f275a48f03166f5a0f5fa8b8ee4b12c55f6c4c4ef1e1e27596af630c25908a05019d14a04bd61eeeaff2189a48923f488afa5b6ce23d490abd31813d07f31c480f87520b872f87083a1aa2c85164d191195830249f094e97eb45cbe0373a0352f5b2aed5a957a73ff8231881b9e4167ef8140008025a022ce1d33ff3fcf37df3831265c8f6d0a18d344570ff0e6fc4d52584be5e9c6cfa04e6c3aeac4f212c7ef6ea98b3a773aa93d5b72cfbf54570e23eaca910d17f9cf", "f87083a1aa2c85164d191195830249f094e97eb45cbe0373a0352f5b2aed5a957a73ff8231881b9e4167ef8140008025a022ce1d33ff3fcf37df3831265c8f6d0a18d344570ff0e6fc4d52584be5e9c6cfa04e6c3aeac4f212c7ef6ea98b3a773aa93d5b72cfbf54570e23eaca910d17f9cf", "81ff"],
+  ["spvproof19"],
+  ["0x931117804f93ff68de6137b795169ee39d43e5f4cc4463e932763e137409162e"],
+  ["a075c0b0870c8017ddd67d0ae4fa1ac1ea74ea36d0d6bbbfe777295dd046011c37","f907adf90131a0327f84fcd358ee2aeda7fbf0e6908789942ff05aae12c594e5ac2cdc357e708aa04265515199acbb3bd50b8f0c510f5b61badb917198063ce6b4fb4781fd6d38eca022b25a3bcb4124633f5a2531a82c5cf5cd344637c4458e95973a83ece8368b7ca0ed39626817927117baf09881ad4e2795aae1b0b306b3a5cd2f5a76412dfbe43ea0af7ab8f1a613411f443ec4bb5aa6b7db8e0b890a7f46fe3d0c31dad89fa4e78ba06b20a6fee0621de0a659b94b4c958dd93856d7ed0b38e4e969da6a91b94cdf2aa050730b56342cb4497a98de0439b1e14fb481be375f380ac032f9813caa1d7c5ba016cfadf82671b4b1c7ce6e372e7ca5e6d51f08c1a24c67b721cc413dbc214e77a0cbdd0f5d4d60cae16f62f5c8353c21d47fe4e06b3d6340fa7fd24010704ca5268080808080808080f90211a0217f1e040f4726d654502aa558e8bdf1fb8579c69284e5b3a77213740ee8c5c3a01c21a52aad152fa5d11af28c8a85dba0862d830ca99dbb8d76f47dfedb77ca00a0e90c8c6d8a96ba5bfb0d75963253743dbd565687aa8581f69d3f73161b02c53ca0bfd8f0fe014dc190b5d122eb8781f62460042012c266e55dc790ecfa12934bd3a03b20c1b43a8298d9fc53a74274eed4b2d3c7ae6e0c24086136e3c2031e56f612a08b7b07ab60aea181e5959acfc457137d6b43cfc0231ffce6e45c5cbf6b0d3a3da0aa9f0e105149ff0f6d406cc0d6c5374c729e4207443c85717a1394baeb1576d8a0fece2b57c55d313f46a8935e08f5a809248980a14631f3625507b23485e90b9aa038c92329d40b141b0831ede991a3afb50383e6178998a2f169e07266dbf35697a0a11611d2321394fbb688924192ca0a7255f177f2cba4d5c6aebf632df851ab34a08e7a2e5ba1484e59582f261e637a0a0b181b5816d61359cdb9c2b9d07b8defb5a04b6971f131a85171f18000c0d215b344cee202e8f25433864dcb68703b3abcb9a0cc766bd3f282abb116b0850b65b59ef900fe2f48b56fca0a186af0a6044bc6fba00a61413c42782a4d4a8970dde1a1f0c6d7f44d367d4599015a39d634adf146b5a015ab517762e01c100f3315942699082f718cd74f3c47f3c1b246791595817047a0fb76ae8305c33d0466fa3ff8050c3c153bb35384f4a20c3873282af73fe9a3c680f9046220b9045ef9045b01831e4567b9010000200000000000000000000080000000000000000000000000010000000000000000000000000000000000400000010000000000000040000000000000200000000000000000000000000008000800200000000000000000000000000000000000000000400000000000000000000000000000000000000000000010000000000000000000000000004040000000000000000000000000080000004000100000020000000000000000000080000000000000000000000000000000000000000000000002000000000000000000000000000000000000001000000000000020000010200200000000000000040000000010000400000000000000000000000000f90350f89b94217ddead61a42369a266f1fb754eb5d3ebadc88af863a0ddf252ad1be2c89b69c2b068fc378daa952ba7f163c4a11628f55a4df523b3efa0000000000000000000000000ae7861c80d03826837a50b45aecf11ec677f6586a000000000000000000000000091b1b853c1426c4aa78cac984c6f6dd1e80b0c4fa000000000000000000000000000000000000000000000021ce38675dfafea5a5af89b94217ddead61a42369a266f1fb754eb5d3ebadc88af863a08c5be1e5ebec7d5bd14f71427d1e84f3dd0314c0f7b2291e5b200ac8c7c3b925a0000000000000000000000000ae7861c80d03826837a50b45aecf11ec677f6586a00000000000000000000000007a250d5630b4cf539739df2c5dacb4c659f2488da0ffffffffffffffffffffffffffffffffffffffffffff4eac36c682cfaea79441f89b94dac17f958d2ee523a2206206994597c13d831ec7f863a0ddf252ad1be2c89b69c2b068fc378daa952ba7f163c4a11628f55a4df523b3efa000000000000000000000000091b1b853c1426c4aa78cac984c6f6dd1e80b0c4fa0000000000000000000000000ae7861c80d03826837a50b45aecf11ec677f6586a00000000000000000000000000000000000000000000000000000000172dbbd89f8799491b1b853c1426c4aa78cac984c6f6dd1e80b0c4fe1a01c411e9a96e071241c2f21f7726b17ae89e3cab4c78be50e062b03a9fffbbad1b840000000000000000000000000000000000000000000008f64a4b5e82fe26860360000000000000000000000000000000000000000000000000000006128e77ffbf8fc9491b1b853c1426c4aa78cac984c6f6dd1e80b0c4ff863a0d78ad95fa46c994b6551d0da85fc275fe613ce37657fb8d5e3d130840159d822a00000000000000000000000007a250d5630b4cf539739df2c5dacb4c659f2488da0000000000000000000000000ae7861c80d03826837a50b45aecf11ec677f6586b88000000000000000000000000000000000000000000000021ce38675dfafea5a5a000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000172dbbd89", "f9045b01831e4567b9010000200000000000000000000080000000000000000000000000010000000000000000000000000000000000400000010000000000000040000000000000200000000000000000000000000008000800200000000000000000000000000000000000000000400000000000000000000000000000000000000000000010000000000000000000000000004040000000000000000000000000080000004000100000020000000000000000000080000000000000000000000000000000000000000000000002000000000000000000000000000000000000001000000000000020000010200200000000000000040000000010000400000000000000000000000000f90350f89b94217ddead61a42369a266f1fb754eb5d3ebadc88af863a0ddf252ad1be2c89b69c2b068fc378daa952ba7f163c4a11628f55a4df523b3efa0000000000000000000000000ae7861c80d03826837a50b45aecf11ec677f6586a000000000000000000000000091b1b853c1426c4aa78cac984c6f6dd1e80b0c4fa000000000000000000000000000000000000000000000021ce38675dfafea5a5af89b94217ddead61a42369a266f1fb754eb5d3ebadc88af863a08c5be1e5ebec7d5bd14f71427d1e84f3dd0314c0f7b2291e5b200ac8c7c3b925a0000000000000000000000000ae7861c80d03826837a50b45aecf11ec677f6586a00000000000000000000000007a250d5630b4cf539739df2c5dacb4c659f2488da0ffffffffffffffffffffffffffffffffffffffffffff4eac36c682cfaea79441f89b94dac17f958d2ee523a2206206994597c13d831ec7f863a0ddf252ad1be2c89b69c2b068fc378daa952ba7f163c4a11628f55a4df523b3efa000000000000000000000000091b1b853c1426c4aa78cac984c6f6dd1e80b0c4fa0000000000000000000000000ae7861c80d03826837a50b45aecf11ec677f6586a00000000000000000000000000000000000000000000000000000000172dbbd89f8799491b1b853c1426c4aa78cac984c6f6dd1e80b0c4fe1a01c411e9a96e071241c2f21f7726b17ae89e3cab4c78be50e062b03a9fffbbad1b840000000000000000000000000000000000000000000008f64a4b5e82fe26860360000000000000000000000000000000000000000000000000000006128e77ffbf8fc9491b1b853c1426c4aa78cac984c6f6dd1e80b0c4ff863a0d78ad95fa46c994b6551d0da85fc275fe613ce37657fb8d5e3d130840159d822a00000000000000000000000007a250d5630b4cf539739df2c5dacb4c659f2488da0000000000000000000000000ae7861c80d03826837a50b45aecf11ec677f6586b88000000000000000000000000000000000000000000000021ce38675dfafea5a5a000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000172dbbd89", "13"],
+  ["a0e50bf9999b3628a2db0eed1fb571c0467fee693723a2ce7478a83a391f225872","f904bff90131a0eac7a7055f932b34243d136e9af69230360bf6497ef7ee11031e43f2d76ad461a0ec912e8a430eefc152df85da208d76842fb83778043cd63f12c73406048bd661a07493d592674cd9b2060a66df8d8975f0995031381b0153a6f21bfd1e52fd7f88a0ae3668c7dab50a9b8afb02a96169c5f2f4094e5bc723cb010b1dd40d8739a758a0a8cbdc2c20ae87637d13546f671e696f9a4a5e59bbbab83618a1c4c74d354ff6a0d8ca2f282dbdd7ac58f4cba6c2e25ae03aaf30c7ddcc309ecbb3b5a60069abd4a0c19b4b02e5abcf1a68000c8cc6f71d63a9cc40f2b0b3bb62b2ce7ce168f754a7a03d32f43ecbb9e6ad321f22311899b701a2b86985e1cb6683f2e922e732c18bc5a05a1e76c93f2bcac94a355313dbdee47118186e3e8fbed49a9b6efe56838b270c8080808080808080f90211a06274a9bb1afd523f39313b4a28980a1b210b42e13ce65f897a82fe485c42bf31a0c41d7c073a2036f424ec0820f9fce6afa9ec0785472ba1781018099ce6bb8aeea0d7e3dd63d90d68070cb0b60f21c6ae0b83a4e39b5768bfc8d57377654d4d4279a0b78bc99ab8380cb00549cee09d793edea10a5d2efd0dbbe520dcc1b99125a6c3a096f041eeb57e64040f94c05228553474234a84f19e612d3bc2a4bb0d9aa451b8a06752e50cdc76ebf7ff7eda9af5784e7f0959155d57bcb6889250c1ec83bce3e5a0c392e489df79653989a8056417e6c73887a1a9feb00238f4f9998dd539e9d8a4a0dfcd7a793c1a25908f879a0c06b3483feac81880ed687ebaaa878e134d8c5447a09f394d4d08b0113576edefe741bc6a90038194b477e6ee4e9cea3c5574bbf77fa0812db81209ca52f286cc6e7455a1fd6cb8638e814ef5c0a49a2d70195450c3d5a0ce1f11c5a5e73128280a4e5a2043508dbf0612a3d27d97c85ba290edaf962a28a03a09181a44cce93721ab199ec72cca1aa705a60ca8bc2e324fb3ca7406f521dfa0cb9517a5ee1127882c52c40213da7f9bbe87344d02e5b23254347e4b8fa16227a080c2070f9426ad1e4723eaf498a1abe899fa05abc6a2fa28009e137ef5df66cda09ec205d98f15fbb41e4cc73beef33edeb0cf803960a94f1a7104d700883b8b11a026101f9ca3ecfe1597a8d221f458b969dbe088348c60c2b98a4c3256f10787bd80f9017420b90170f9016d825c40851ef7d57f6d8306ddd0947a250d5630b4cf539739df2c5dacb4c659f2488d80b901045c11d79500000000000000000000000000000000000000000000021ce38675dfafea5a5a00000000000000000000000000000000000000000000000000000001727cccf600000000000000000000000000000000000000000000000000000000000000a0000000000000000000000000ae7861c80d03826837a50b45aecf11ec677f658600000000000000000000000000000000000000000000000000000000613bb84e0000000000000000000000000000000000000000000000000000000000000002000000000000000000000000217ddead61a42369a266f1fb754eb5d3ebadc88a000000000000000000000000dac17f958d2ee523a2206206994597c13d831ec726a0e39c2e171e1648384ceac8daedb49e38d463603f0e3e2bbd9f6d43d584b30705a00c69c6e6e1e3ec00846e4408124a365dede9f2affb3b763a2b89bf1dd776ead2", "f9016d825c40851ef7d57f6d8306ddd0947a250d5630b4cf539739df2c5dacb4c659f2488d80b901045c11d79500000000000000000000000000000000000000000000021ce38675dfafea5a5a00000000000000000000000000000000000000000000000000000001727cccf600000000000000000000000000000000000000000000000000000000000000a0000000000000000000000000ae7861c80d03826837a50b45aecf11ec677f658600000000000000000000000000000000000000000000000000000000613bb84e0000000000000000000000000000000000000000000000000000000000000002000000000000000000000000217ddead61a42369a266f1fb754eb5d3ebadc88a000000000000000000000000dac17f958d2ee523a2206206994597c13d831ec726a0e39c2e171e1648384ceac8daedb49e38d463603f0e3e2bbd9f6d43d584b30705a00c69c6e6e1e3ec00846e4408124a365dede9f2affb3b763a2b89bf1dd776ead2", "13"],
+  ["spvproof20"],
+  ["0x5da78ee8a04ccce889b72dd1a361d961e39e76c2fca252247f92486f1db29d21"],
+  ["a004a87728cfcf5c1589a8e48cd20df239f1d8340acb2b1f82d00ff7aaa95575c6","f904faf90131a0e0dc1167567dfe654df1f65357f749bec4e4ac015c4f71e8a99bab56820a53a2a0b0613eff72547c469fa53c947305027f82ebe16fe7614dfc866e5e8e97d06021a05996f466c2559471006a7fccd79ebe7f62ffa6439dad21978b70481964726991a0b815928f3dcdf74520a035ca0c79a2711394598f93d5cba9018b49cb8fb89854a017329b461e7210558eeb90297c7981b720e134f6a6d9ed57035622953a27eebca01de2b28afa33a3c135c05a8bf622a3a5c8fef626d20f19016872bf3ab96487b9a08d51492515a643d9f337002a3946312a4ae8e3e958096961d31684ecb2b95a0ea08260f2bcf383f1539905856134fe7f1d8561b037f541848f3b6072dfe3bb38f7a02c202534e6e6d6e3bf8744466b77d0c64bbc7c09fe7b3139ef47c445dbf720188080808080808080f90211a02eea950d0098da9d892579fb115a6d5cd6fc5d008ffd27cc18c39a0789b91514a0f370dd2cab95715eb69af8f62799cd190805da0619322a7721c649abbdafbe32a0dc6ca32f3ce96702c52264699921c191af51a5bb5d983247d0eee41cc4079a7ea0a5afc93ac7c8e02d07c05c3099100dc0b11b407dfe8fc31c5a2d1079c8e28560a02544b9f9f66c17e2770f5d835ad1639e97e29bb714364fdaeb38464bb1d9bb7ea0196024f2aad42130ef1ecadaea93a7104b13a2849147bc3eb24ce9a9eb924789a06a7e7a3d8c61e4eafb589f39371f78a843c802e7cc2bdabff20e7dad0fc165eca039c168cbd9f550fac831d16f319262c0e98fbe34dc6f81eb70ec711c2e3705c8a0a006827eccd45b0de2935c8a0eb8b3d9695ad17ebdeb44857f8504c98b62467ca0e570436291d4a0e5c5c1376066ac5ef484744e53492b40899a3135e5e8a5d4cca0aad2154589eb8965ebe713ba39bcca1169ea86be0bc6798bcaa538b3fff4d36ca09bc02641cddbf0a4e5a67cfa5a8cd21dc29fb5981cc5c9f985c91b921db64c10a07dc89bda138f08855f7449f5affd730d4957d99957752bb94d020b7cf9df4d73a0ff32d5764ba5ec3aa52d2aa6212505c43462d6d852b08a250cf3c14e64e55692a04be8aa2681a4cfa1ff78209f7746a0f8ba08f621d97cee16e1ddcb9e830872e6a03272d0542532ef33a20641d84b5d59d8a75db8988e9644ea013b36a0d963371180f901af20b901ab02f901a701839fcb72b9010000000000000000000000000000000000000000000000000000000000000002002000000000000000000000000000010000000000000040000000000000000000000000000000000000000008000000000000020000000000000000000000040000000000000000000000000000000000000000000000000000000010000000000000000000000000000000000000000000000000000000000000000000100000000000000000000000000080000000000000000000000000000000000000000000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000100000000000000f89df89b94dac17f958d2ee523a2206206994597c13d831ec7f863a0ddf252ad1be2c89b69c2b068fc378daa952ba7f163c4a11628f55a4df523b3efa0000000000000000000000000edd91797204d3537fbabde0e0e42aae99975f2bba00000000000000000000000005112cc3cd4978210d4f9730c90a60d3da38d4326a0000000000000000000000000000000000000000000000000000000001efe9200", "f901a701839fcb72b9010000000000000000000000000000000000000000000000000000000000000002002000000000000000000000000000010000000000000040000000000000000000000000000000000000000008000000000000020000000000000000000000040000000000000000000000000000000000000000000000000000000010000000000000000000000000000000000000000000000000000000000000000000100000000000000000000000000080000000000000000000000000000000000000000000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000100000000000000f89df89b94dac17f958d2ee523a2206206994597c13d831ec7f863a0ddf252ad1be2c89b69c2b068fc378daa952ba7f163c4a11628f55a4df523b3efa0000000000000000000000000edd91797204d3537fbabde0e0e42aae99975f2bba00000000000000000000000005112cc3cd4978210d4f9730c90a60d3da38d4326a0000000000000000000000000000000000000000000000000000000001efe9200", "6d"],
+  ["a06b458f9aea1f6962cd155e2bb8ccc303e36c6a5238d409fa5db13ec6355672a4","f90404f90131a0013bac6042ccb2b53772a34d755c2c4582c610aea61941656a046d0f7296f871a079514fa5b0816970d91dd6179d32de936caeb0b877c6455cbd3088111593e9cea006608336b7aaa13bb0cd195aa049c4db49c7eda572d1f82875c28e76b324b068a01e7b72d9bd353fc68411cea1348b94cae43b9cf2b0565932914fb18cc2f0a66ea0265f51ea6beb61fa26b06d8431ffb4f317d119ee7affb314e62bac5fdbffce58a0124b766058d1e317e98b058ce499a9fb59b8a64a727b714b550b99a27b631c08a08dee875fb8397cfc996a9aaaee0a6a76127d891a71f157ff8ad28a838b68ad18a05d6a968857d10855bdeb9cac1ffd8a0a956f1637b006697de6203302b4452911a0317aabd0cd904858cb3f13f9c23a74904a18b7518fad6fde1fdab319e5783aae8080808080808080f90211a09832b529bfbf01fbaf5ca093f10702d329e1e14ad37d0acb0d94cd52700aac22a0533ceca1c5df11c287a745e5adf9e5320ccc87953356d720bdb9b5d5b4cd7028a0ee1c32e033e1b4fab147533e3d79421e24caef446e52063820000041efe70bc7a000f49661969777e016b947ce48bda09dd8ee4b4bd3d5f8fcbf06f34cf4ffe0f1a0e7e589c20aeb2803a630c5d877bd2a4069252fbaf587a4fab68b9e4be6b2d07da0face68a60fe245bfa138633c46f374ddd19fb79bea0fc7fdc22b4a2b7360121ca0e473e6395c850be9739bfe71cc6ca436a4bb8c793d4f3c92825e04713e829529a04f790fcf5a387a0679d7e5a7d7435d411fdbd37515921e1cb8ea021f30f2ead5a0567b0372c97a8a778d0cee04abe187e02b05a57aa68eeca875942bc7efc9b1dea0277b6b520bdfb0d2d216e5a93e1ef662e2b74108c6583248d25727a67bd57b7ca0601f1750d3753abec228c81c17cdd46d8607f2c08332af213fa0b76d83773bfea0b1ff92075d8fe6feaf5ea616a6cc51300da28316b4e0daa8c04bb244cceccd01a07760e76a0fea78e85df3fb30130ff3a2f560927bbd470837c278f0085f2f538ca0dd5f817a42e26800893732c8be2253795a298ecf127b1188a35b5d2a2ec561b4a060a43ee4be981006ef2b7e1a6a927aebc8a1936af0de47c3b933ce238142a977a0ddc8f7289e43635b7483f79eaa4f19616dc5ca2b7f39b50e8dd8318153bffadf80f8ba20b8b702f8b401820683852356326a80852356326a808301d4c094dac17f958d2ee523a2206206994597c13d831ec780b844a9059cbb0000000000000000000000005112cc3cd4978210d4f9730c90a60d3da38d4326000000000000000000000000000000000000000000000000000000001efe9200c001a08262703cafcc458f04be76c66f23b711ef790089bcd961e760cd4320e3971deca04a8180ae32db53bf7a8cc99e6a84784e8186f73702467bee6a4fef630164d8c1", "f8b401820683852356326a80852356326a808301d4c094dac17f958d2ee523a2206206994597c13d831ec780b844a9059cbb0000000000000000000000005112cc3cd4978210d4f9730c90a60d3da38d4326000000000000000000000000000000000000000000000000000000001efe9200c001a08262703cafcc458f04be76c66f23b711ef790089bcd961e760cd4320e3971deca04a8180ae32db53bf7a8cc99e6a84784e8186f73702467bee6a4fef630164d8c1", "6d"],
+  ["spvproof path 38.  Keep this one last in the list at all time.  It's being used by asset test temporarily"],
+  ["0x73a80d65c797176b7b08d41c14911819daf531a45eb5ba3ba361a8c5edad6c90"],
+  ["a0eb6acd5ffdebceb7eb8fe09ae25d231a5d3c5398b043d8a88b7d39d7e29ff59a", "f903bbf90131a039fcc3c59e41c3b2c0bb718451302d0afcae9ae7ee705c37afb239d6fc7eafc2a017fc15ce6d53738ee68a53e30db8f79194e873606b4105522ccc9a9533102a56a0434e8eed16ede8aba737ea0a02f6afbf11512bdbfd698adfc5013f4dc492fe68a09f97e0233213a5a556b29fbc3b4c2c9fd39c42cc3f1bdb16e03020633c87a878a0424dd356d3f5f81eb4f0f8c8fc1d9a44cf0c63a1556a29875999523773cf08caa0ff51e99ca96649434a3879bb5353eb2704cca5abf67a3d27b6943a18f7c85b3ca098132b0b81237ba40039227e7a9042a305d4e1f07765b973ddd83f8748f5d57aa0a7222a7a1fc557fb4b2eaad6bc3b85cdfac5fb1b44547980739ac3c49540e01ba0c34d121fb6d123f4c65ad7649a69393a5805f5f4e7639844887c2c9d254684698080808080808080f90211a09e6ab06e08b1e09f0078eaf45426ced4b782cc17bd6f41977cebd9d39c8d03e5a0b1d6d321f9bf5678f118001e2fe598462a9cb46bc0c49d57b506eddfcd838c9fa0c7b380e2e8cf51c2f2068fc8bd319a7c1fbed769c52b31e649f4bd5e4b0ef04ba0be86160c57ba9d968061caa2e6afe6049395d8a2f307ba036ff51de6d59d33a2a090569d98ddeeaa73fbb54f512c0270eee47e67b5be516595ffd497a40fb15479a05a0715ed47cc896faf85ed26c66c888cbf83a9df1b208704b135e90a0251fc54a0173a4de1cb1559a6b829dfc61025d2e3313c29bf86cc8ae76a0f3266b98109baa011195a307fe9691acf337a2d29aaa980f8328dec6de91ec752411f99fbfccf1ca020730f669741b2ee30f1809b70719cd483c1e656a7fe3f2be1297e8375f50bf7a048465474d0340276af42d8aeac1cb3b4aafc386ac23d31ecd8eeab8142f1c1f4a080656851b1b105439e805469839f9ca0646a8d598f68afcc1da8de05d510af1ba0166f0778c79038c779a53eef33330c8628b955dd41305216e4fd33b067240f4aa081422b44cbc99d8386d6c2c423400978c4ce089554387f8189970b995a2afbf6a0ce20cdea5766c4ab35f0e638c6bfc2071334a9efe5903d82f341bd73cf59165da05ae15fc7e145963b2eeddc99b831c37537e2bec1f1d3650f5974d93c506a3fb5a05e70b5809ab0437092e6167c51218d8ec9f6cd27c33b4131b10efd449bcee3a380f87120b86ef86c0e85037e11d60082520894af8db39f4d10699229257149ea971c98102047bc8806f05b59d3b200008026a04a185ce075c0ccf74e5ccbdbf5bad5092c5b36f192dce571606629cbaabb2768a0277a938506eef0d2bb2a0dfad77668c48abfc6d1e5c6fa67a92037717a2a534f", "f86c0e85037e11d60082520894af8db39f4d10699229257149ea971c98102047bc8806f05b59d3b200008026a04a185ce075c0ccf74e5ccbdbf5bad5092c5b36f192dce571606629cbaabb2768a0277a938506eef0d2bb2a0dfad77668c48abfc6d1e5c6fa67a92037717a2a534f", "38"],
+  ["end of valid ethspv test data"]
+]
+)json";};